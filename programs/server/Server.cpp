@@ -19,6 +19,7 @@
 #include <common/getMemoryAmount.h>
 #include <common/errnoToString.h>
 #include <common/coverage.h>
+#include <Common/ArenaChunkPool.h>
 #include <Common/ClickHouseRevision.h>
 #include <Common/DNSResolver.h>
 #include <Common/CurrentMetrics.h>
@@ -583,6 +584,21 @@ int Server::main(const std::vector<std::string> & /*args*/)
     }
     global_context->setMarkCache(mark_cache_size);
 
+    /// Size of cache for results of aggregation queries. Zero means disabled.
+    size_t aggregation_result_cache_size = config().getUInt64("aggregation_result_cache_size", 0);
+    if (aggregation_result_cache_size)
+        global_context->setAggregationResultCache(aggregation_result_cache_size);
+
+    /// Size of cache for built join tables. Zero means disabled.
+    size_t join_cache_size = config().getUInt64("join_cache_size", 0);
+    if (join_cache_size)
+        global_context->setJoinCache(join_cache_size);
+
+    /// Size of the pool of recycled Arena chunks used for aggregation and join states. Optional.
+    size_t arena_chunk_pool_size = config().getUInt64("arena_chunk_pool_size", 0);
+    if (arena_chunk_pool_size)
+        ArenaChunkPool::instance().setMaxBytes(arena_chunk_pool_size);
+
 #if USE_EMBEDDED_COMPILER
     size_t compiled_expression_cache_size = config().getUInt64("compiled_expression_cache_size", 500);
     if (compiled_expression_cache_size)
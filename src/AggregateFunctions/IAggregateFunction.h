@@ -42,6 +42,15 @@ struct AggregateFunctionProperties;
   * The data resulting from the aggregation (intermediate computing states) is stored in other objects
   *  (which can be created in some memory pool),
   *  and IAggregateFunction is the external interface for manipulating them.
+  *
+  * NOTE: States are strictly accumulate-and-merge: there is deliberately no interface to retract
+  * a row from a state. This is what stands between this tree and window functions with
+  * frame-incremental evaluation (sliding OVER frames maintained by add/remove): most functions
+  * here have no inverse (min/max, uniq*, quantile*), so a window engine cannot be a thin
+  * processor over these states — it needs either invertible-state variants or segment-tree
+  * recombination of partial states, on top of OVER parsing, analysis, and a partition-aware
+  * blocking transform. That is an engine-sized project, not an incremental change to this
+  * interface.
   */
 class IAggregateFunction
 {
@@ -180,6 +189,17 @@ public:
         const IColumn ** columns,
         Arena * arena) const = 0;
 
+    /** Same for UInt16 keys with an AggregateDataPtr[65536] lookup table.
+      */
+    virtual void addBatchLookupTable16(
+        size_t batch_size,
+        AggregateDataPtr * places,
+        size_t place_offset,
+        std::function<void(AggregateDataPtr &)> init,
+        const UInt16 * key,
+        const IColumn ** columns,
+        Arena * arena) const = 0;
+
     /** By default all NULLs are skipped during aggregation.
      *  If it returns nullptr, the default one will be used.
      *  If an aggregate function wants to use something instead of the default one, it overrides this function and returns its own null adapter.
@@ -297,6 +317,47 @@ public:
             static_cast<const Derived *>(this)->add(place + place_offset, columns, i, arena);
         }
     }
+
+    /// Unlike the UInt8 case, no additional per-function lookup tables are used:
+    /// they would be too large (65536 states each) to stay in cache.
+    void addBatchLookupTable16(
+        size_t batch_size,
+        AggregateDataPtr * map,
+        size_t place_offset,
+        std::function<void(AggregateDataPtr &)> init,
+        const UInt16 * key,
+        const IColumn ** columns,
+        Arena * arena) const override
+    {
+        static constexpr size_t UNROLL_COUNT = 8;
+
+        size_t i = 0;
+
+        size_t batch_size_unrolled = batch_size / UNROLL_COUNT * UNROLL_COUNT;
+        for (; i < batch_size_unrolled; i += UNROLL_COUNT)
+        {
+            AggregateDataPtr places[UNROLL_COUNT];
+            for (size_t j = 0; j < UNROLL_COUNT; ++j)
+            {
+                AggregateDataPtr & place = map[key[i + j]];
+                if (unlikely(!place))
+                    init(place);
+
+                places[j] = place;
+            }
+
+            for (size_t j = 0; j < UNROLL_COUNT; ++j)
+                static_cast<const Derived *>(this)->add(places[j] + place_offset, columns, i + j, arena);
+        }
+
+        for (; i < batch_size; ++i)
+        {
+            AggregateDataPtr & place = map[key[i]];
+            if (unlikely(!place))
+                init(place);
+            static_cast<const Derived *>(this)->add(place + place_offset, columns, i, arena);
+        }
+    }
 };
 
 
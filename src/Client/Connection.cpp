@@ -437,6 +437,14 @@ void Connection::sendCancel()
 }
 
 
+/// NOTE: The codec is fixed per connection here, but that is a policy choice, not a protocol one:
+/// every compressed frame carries its own method byte, so the peer can decode a stream that
+/// switches between LZ4/ZSTD/none per block. What keeps us from doing it adaptively is the lack of
+/// a trustworthy signal — the sender can only time how fast the peer drains the socket, which
+/// mixes link bandwidth with receiver processing backpressure, so a controller would flip to heavy
+/// compression whenever the peer is simply busy. Endpoints know their topology better than we can
+/// guess: use network_compression_method / network_zstd_compression_level per connection (e.g.
+/// ZSTD in the cross-DC distributed cluster config, LZ4 for local clients).
 void Connection::sendData(const Block & block, const String & name, bool scalar)
 {
     if (!block_out)
@@ -18,6 +18,16 @@ namespace DB
   *  pools with the same number of errors are tried in random order.
   *
   * Note: if one of the nested pools is blocked due to overflow, then this pool will also be blocked.
+  *
+  * NOTE Hedged requests (start a backup connection to another replica when the chosen one has not
+  * produced data within some latency-quantile timeout, keep the winner, cancel the loser) do not
+  * fit the current receive model: RemoteBlockInputStream blocks inside Connection::receivePacket,
+  * so there is no place to notice "first replica is slow" and no event loop to race two sockets.
+  * Implementing them means rebuilding the receive path around non-blocking sockets plus careful
+  * draining/cancellation of the losing replica - a separate project, not an addition to this pool.
+  * Until then the practical mitigations are load_balancing = nearest_hostname / first_or_random,
+  * error-count-based replica ranking (which this pool already does), and
+  * max_replica_delay_for_distributed_queries to route around lagging replicas.
   */
 
 /// Specifies how many connections to return from ConnectionPoolWithFailover::getMany() method.
@@ -15,6 +15,19 @@ namespace DB
   * It is assumed that all functions except sendCancel are always executed in one thread.
   *
   * The interface is almost the same as Connection.
+  *
+  * NOTE: Fully asynchronous connect/handshake fan-out across shards was considered and not done
+  * here. Cross-shard setup is not serial to begin with: each shard has its own RemoteQueryExecutor,
+  * and its connections are established lazily by whichever pipeline thread first reads that remote
+  * source, so shards connect concurrently up to max_threads. What is sequential is replica
+  * selection *within* a shard: ConnectionPoolWithFailover tries replicas in error-count order, and
+  * whether replica N is contacted at all depends on the outcome of replica N-1 — parallelizing that
+  * would change failover semantics, not just latency. Overlapping TCP/TLS handshakes below that
+  * logic runs into the same blocker as hedged requests (see ConnectionPoolWithFailover.h): the
+  * Connection is a blocking state machine with no partially-established state to poll. The cold
+  * pool cost is also paid only until pools warm up — entries are kept alive and reused across
+  * queries (distributed_connections_pool_size) — so pre-warming would buy the first query after
+  * restart at the price of background handshakes that race idle timeouts.
   */
 class MultiplexedConnections final : private boost::noncopyable
 {
@@ -18,6 +18,16 @@ namespace ErrorCodes
 
 /** ColumnConst contains another column with single element,
   *  but looks like a column with arbitrary amount of same elements.
+  *
+  * NOTE A run-length-encoded sibling of this class (for sorted key columns with long runs) was
+  * considered and rejected. ColumnConst only works because constness is part of the block
+  * structure: it is known at query analysis time and holds for every chunk that passes a port.
+  * An RLE column would be a per-chunk property, so every processor boundary would have to either
+  * understand runs or expand them - and since almost all kernels index rows directly, in practice
+  * it degenerates into expand-right-after-read with extra branching everywhere. The benefit it
+  * targets is already obtained at a higher level: reading in order feeds
+  * optimize_aggregation_in_order, which aggregates runs of equal keys without per-row hash table
+  * lookups.
   */
 class ColumnConst final : public COWHelper<IColumn, ColumnConst>
 {
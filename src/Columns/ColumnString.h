@@ -20,6 +20,13 @@ namespace DB
 {
 
 /** Column for String values.
+  *
+  * An arena-backed variant for short-lived intermediates (chars carved from a per-query Arena
+  * with bulk free) was considered and does not pay off here: code all over the tree downcasts to
+  * this exact class and pokes chars/offsets directly, so a second string column type would have
+  * to be handled at each of those places, and columns routinely outlive the operator that made
+  * them (ORDER BY, joins, scattering), which defeats chunk-lifetime arenas. Allocation churn for
+  * temporaries is instead kept down by the PODArray growth policy and jemalloc size classes.
   */
 class ColumnString final : public COWHelper<IColumn, ColumnString>
 {
@@ -31,6 +31,12 @@
     #include <emmintrin.h>
 #endif
 
+#include <Common/TargetSpecific.h>
+
+#if USE_MULTITARGET_CODE
+    #include <immintrin.h>
+#endif
+
 namespace DB
 {
 
@@ -42,6 +48,99 @@ namespace ErrorCodes
     extern const int LOGICAL_ERROR;
 }
 
+/** Implementations of ColumnVector::filter for POD types, compiled for several instruction sets.
+  * The widest one supported by the CPU is chosen at runtime.
+  * Based on the assumption that often pieces of consecutive values
+  *  completely pass or do not pass the filter.
+  * Therefore, we will optimistically check the parts of `SIMD_BYTES` values.
+  */
+
+DECLARE_DEFAULT_CODE(
+template <typename T, typename Container>
+void filterImpl(const UInt8 * filt_pos, const UInt8 * filt_end, const T * data_pos, Container & res_data)
+{
+#ifdef __SSE2__
+    static constexpr size_t SIMD_BYTES = 16;
+    const __m128i zero16 = _mm_setzero_si128();
+    const UInt8 * filt_end_sse = filt_pos + (filt_end - filt_pos) / SIMD_BYTES * SIMD_BYTES;
+
+    while (filt_pos < filt_end_sse)
+    {
+        int mask = _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(filt_pos)), zero16));
+
+        if (0 == mask)
+        {
+            /// Nothing is inserted.
+        }
+        else if (0xFFFF == mask)
+        {
+            res_data.insert(data_pos, data_pos + SIMD_BYTES);
+        }
+        else
+        {
+            for (size_t i = 0; i < SIMD_BYTES; ++i)
+                if (filt_pos[i])
+                    res_data.push_back(data_pos[i]);
+        }
+
+        filt_pos += SIMD_BYTES;
+        data_pos += SIMD_BYTES;
+    }
+#endif
+
+    while (filt_pos < filt_end)
+    {
+        if (*filt_pos)
+            res_data.push_back(*data_pos);
+
+        ++filt_pos;
+        ++data_pos;
+    }
+}
+) // DECLARE_DEFAULT_CODE
+
+DECLARE_AVX2_SPECIFIC_CODE(
+template <typename T, typename Container>
+void filterImpl(const UInt8 * filt_pos, const UInt8 * filt_end, const T * data_pos, Container & res_data)
+{
+    static constexpr size_t SIMD_BYTES = 32;
+    const __m256i zero32 = _mm256_setzero_si256();
+    const UInt8 * filt_end_avx2 = filt_pos + (filt_end - filt_pos) / SIMD_BYTES * SIMD_BYTES;
+
+    while (filt_pos < filt_end_avx2)
+    {
+        UInt32 mask = _mm256_movemask_epi8(_mm256_cmpgt_epi8(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(filt_pos)), zero32));
+
+        if (0 == mask)
+        {
+            /// Nothing is inserted.
+        }
+        else if (0xFFFFFFFF == mask)
+        {
+            res_data.insert(data_pos, data_pos + SIMD_BYTES);
+        }
+        else
+        {
+            for (size_t i = 0; i < SIMD_BYTES; ++i)
+                if (filt_pos[i])
+                    res_data.push_back(data_pos[i]);
+        }
+
+        filt_pos += SIMD_BYTES;
+        data_pos += SIMD_BYTES;
+    }
+
+    while (filt_pos < filt_end)
+    {
+        if (*filt_pos)
+            res_data.push_back(*data_pos);
+
+        ++filt_pos;
+        ++data_pos;
+    }
+}
+) // DECLARE_AVX2_SPECIFIC_CODE
+
 template <typename T>
 StringRef ColumnVector<T>::serializeValueIntoArena(size_t n, Arena & arena, char const *& begin) const
 {
@@ -400,49 +499,12 @@ ColumnPtr ColumnVector<T>::filter(const IColumn::Filter & filt, ssize_t result_s
         const UInt8 * filt_end = filt_pos + size;
         const T * data_pos = data.data();
 
-#ifdef __SSE2__
-        /** A slightly more optimized version.
-        * Based on the assumption that often pieces of consecutive values
-        *  completely pass or do not pass the filter.
-        * Therefore, we will optimistically check the parts of `SIMD_BYTES` values.
-        */
-
-        static constexpr size_t SIMD_BYTES = 16;
-        const __m128i zero16 = _mm_setzero_si128();
-        const UInt8 * filt_end_sse = filt_pos + size / SIMD_BYTES * SIMD_BYTES;
-
-        while (filt_pos < filt_end_sse)
-        {
-            int mask = _mm_movemask_epi8(_mm_cmpgt_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(filt_pos)), zero16));
-
-            if (0 == mask)
-            {
-                /// Nothing is inserted.
-            }
-            else if (0xFFFF == mask)
-            {
-                res_data.insert(data_pos, data_pos + SIMD_BYTES);
-            }
-            else
-            {
-                for (size_t i = 0; i < SIMD_BYTES; ++i)
-                    if (filt_pos[i])
-                        res_data.push_back(data_pos[i]);
-            }
-
-            filt_pos += SIMD_BYTES;
-            data_pos += SIMD_BYTES;
-        }
+#if USE_MULTITARGET_CODE
+        if (isArchSupported(TargetArch::AVX2))
+            TargetSpecific::AVX2::filterImpl(filt_pos, filt_end, data_pos, res_data);
+        else
 #endif
-
-        while (filt_pos < filt_end)
-        {
-            if (*filt_pos)
-                res_data.push_back(*data_pos);
-
-            ++filt_pos;
-            ++data_pos;
-        }
+            TargetSpecific::Default::filterImpl(filt_pos, filt_end, data_pos, res_data);
     }
     else
     {
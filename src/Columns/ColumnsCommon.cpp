@@ -103,16 +103,16 @@ namespace
             res_offsets.push_back(current_src_offset);
         }
 
-        template <size_t SIMD_BYTES>
         void insertChunk(
             const IColumn::Offset * src_offsets_pos,
             bool first,
             IColumn::Offset chunk_offset,
-            size_t chunk_size)
+            size_t chunk_size,
+            size_t n)
         {
             const auto offsets_size_old = res_offsets.size();
-            res_offsets.resize(offsets_size_old + SIMD_BYTES);
-            memcpy(&res_offsets[offsets_size_old], src_offsets_pos, SIMD_BYTES * sizeof(IColumn::Offset));
+            res_offsets.resize(offsets_size_old + n);
+            memcpy(&res_offsets[offsets_size_old], src_offsets_pos, n * sizeof(IColumn::Offset));
 
             if (!first)
             {
@@ -124,7 +124,7 @@ namespace
                     auto * res_offsets_pos = &res_offsets[offsets_size_old];
 
                     /// adjust offsets
-                    for (size_t i = 0; i < SIMD_BYTES; ++i)
+                    for (size_t i = 0; i < n; ++i)
                         res_offsets_pos[i] -= diff_offset;
                 }
             }
@@ -138,11 +138,11 @@ namespace
         void reserve(ssize_t, size_t) {}
         void insertOne(size_t) {}
 
-        template <size_t SIMD_BYTES>
         void insertChunk(
             const IColumn::Offset *,
             bool,
             IColumn::Offset,
+            size_t,
             size_t)
         {
         }
@@ -192,39 +192,63 @@ namespace
 
     #ifdef __SSE2__
         const __m128i zero_vec = _mm_setzero_si128();
-        static constexpr size_t SIMD_BYTES = 16;
+        static constexpr size_t SIMD_BYTES = 64;
         const auto * filt_end_aligned = filt_pos + size / SIMD_BYTES * SIMD_BYTES;
 
+        /// Bitmask of 64 filter bytes: bit i is set iff row i passes the filter.
+        const auto get_mask = [&zero_vec](const UInt8 * pos)
+        {
+            return static_cast<UInt64>(_mm_movemask_epi8(_mm_cmpgt_epi8(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos)), zero_vec)))
+                | (static_cast<UInt64>(_mm_movemask_epi8(_mm_cmpgt_epi8(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos + 16)), zero_vec))) << 16)
+                | (static_cast<UInt64>(_mm_movemask_epi8(_mm_cmpgt_epi8(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos + 32)), zero_vec))) << 32)
+                | (static_cast<UInt64>(_mm_movemask_epi8(_mm_cmpgt_epi8(
+                    _mm_loadu_si128(reinterpret_cast<const __m128i *>(pos + 48)), zero_vec))) << 48);
+        };
+
+        /// Copy n consecutive arrays (their elements are contiguous in src_elems) with a single memcpy.
+        const auto copy_chunk = [&](const IColumn::Offset * offset_ptr, size_t n)
+        {
+            const auto first = offset_ptr == offsets_begin;
+
+            const auto chunk_offset = first ? 0 : offset_ptr[-1];
+            const auto chunk_size = offset_ptr[n - 1] - chunk_offset;
+
+            result_offsets_builder.insertChunk(offset_ptr, first, chunk_offset, chunk_size, n);
+
+            const auto elems_size_old = res_elems.size();
+            res_elems.resize(elems_size_old + chunk_size);
+            memcpy(&res_elems[elems_size_old], &src_elems[chunk_offset], chunk_size * sizeof(T));
+        };
+
         while (filt_pos < filt_end_aligned)
         {
-            const auto mask = _mm_movemask_epi8(_mm_cmpgt_epi8(
-                _mm_loadu_si128(reinterpret_cast<const __m128i *>(filt_pos)),
-                zero_vec));
+            UInt64 mask = get_mask(filt_pos);
 
             if (mask == 0)
             {
                 /// SIMD_BYTES consecutive rows do not pass the filter
             }
-            else if (mask == 0xffff)
+            else if (mask == ~UInt64(0))
             {
                 /// SIMD_BYTES consecutive rows pass the filter
-                const auto first = offsets_pos == offsets_begin;
-
-                const auto chunk_offset = first ? 0 : offsets_pos[-1];
-                const auto chunk_size = offsets_pos[SIMD_BYTES - 1] - chunk_offset;
-
-                result_offsets_builder.template insertChunk<SIMD_BYTES>(offsets_pos, first, chunk_offset, chunk_size);
-
-                /// copy elements for SIMD_BYTES arrays at once
-                const auto elems_size_old = res_elems.size();
-                res_elems.resize(elems_size_old + chunk_size);
-                memcpy(&res_elems[elems_size_old], &src_elems[chunk_offset], chunk_size * sizeof(T));
+                copy_chunk(offsets_pos, SIMD_BYTES);
             }
             else
             {
-                for (size_t i = 0; i < SIMD_BYTES; ++i)
-                    if (filt_pos[i])
-                        copy_array(offsets_pos + i);
+                /// Copy every run of consecutive surviving rows at once:
+                /// adjacent survivors are the common case and their elements are contiguous.
+                while (mask)
+                {
+                    const size_t run_begin = __builtin_ctzll(mask);
+                    const size_t run_end = run_begin + __builtin_ctzll(~(mask >> run_begin));
+
+                    copy_chunk(offsets_pos + run_begin, run_end - run_begin);
+
+                    mask = run_end == 64 ? 0 : mask & (~UInt64(0) << run_end);
+                }
             }
 
             filt_pos += SIMD_BYTES;
@@ -0,0 +1,107 @@
+#include <cstdlib>
+#include <iostream>
+#include <numeric>
+#include <random>
+
+#include <pcg_random.hpp>
+
+#include <Columns/ColumnString.h>
+#include <Columns/ColumnVector.h>
+#include <Columns/IColumn.h>
+#include <Common/Stopwatch.h>
+
+/** Measures the throughput of the column filter and permute kernels, which sit under every
+  * WHERE and ORDER BY. Output is tab-separated (kernel, rows, parameter, seconds, rows/sec)
+  * so runs can be diffed across commits. Data is generated from a fixed seed to keep runs
+  * comparable.
+  *
+  * Other core kernels already have standalone measurements next to their code:
+  * hash tables - src/Common/tests/integer_hash_tables_and_hashes.cpp and hash_table.cpp,
+  * radix sort - src/Common/tests/radix_sort.cpp, arenas and PODArray growth -
+  * src/Common/tests/arena_with_free_lists.cpp and pod_array.cpp, LZ4 decompression -
+  * src/Compression/tests.
+  */
+
+using namespace DB;
+
+
+static ColumnPtr createNumericColumn(size_t rows, pcg64 & rng)
+{
+    auto column = ColumnUInt64::create();
+    auto & data = column->getData();
+    data.resize(rows);
+    for (size_t i = 0; i < rows; ++i)
+        data[i] = rng();
+    return column;
+}
+
+static ColumnPtr createStringColumn(size_t rows, pcg64 & rng)
+{
+    auto column = ColumnString::create();
+    std::string value;
+    for (size_t i = 0; i < rows; ++i)
+    {
+        value.resize(8 + rng() % 24);
+        for (auto & c : value)
+            c = 'a' + rng() % 26;
+        column->insertData(value.data(), value.size());
+    }
+    return column;
+}
+
+static IColumn::Filter createFilter(size_t rows, double selectivity, pcg64 & rng)
+{
+    IColumn::Filter filter(rows);
+    for (size_t i = 0; i < rows; ++i)
+        filter[i] = rng() % 1000 < selectivity * 1000;
+    return filter;
+}
+
+static IColumn::Permutation createPermutation(size_t rows, pcg64 & rng)
+{
+    IColumn::Permutation permutation(rows);
+    std::iota(permutation.begin(), permutation.end(), 0);
+    std::shuffle(permutation.begin(), permutation.end(), rng);
+    return permutation;
+}
+
+template <typename F>
+static void run(const char * kernel, size_t rows, double parameter, F && func)
+{
+    Stopwatch watch;
+    auto result = func();
+    watch.stop();
+
+    std::cout << kernel << '\t' << rows << '\t' << parameter << '\t'
+        << watch.elapsedSeconds() << '\t'
+        << static_cast<size_t>(rows / watch.elapsedSeconds()) << '\n';
+
+    /// Keep the result alive until after the measurement so the kernel is not optimized out.
+    if (result->size() > rows)
+        std::cerr << "impossible\n";
+}
+
+
+int main(int argc, char ** argv)
+{
+    size_t rows = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : 16 * 1024 * 1024;
+
+    pcg64 rng(42);
+
+    auto numeric_column = createNumericColumn(rows, rng);
+    auto string_column = createStringColumn(rows, rng);
+    auto permutation = createPermutation(rows, rng);
+
+    for (double selectivity : {0.01, 0.1, 0.5, 0.9})
+    {
+        auto filter = createFilter(rows, selectivity, rng);
+
+        run("filter_UInt64", rows, selectivity, [&] { return numeric_column->filter(filter, -1); });
+        run("filter_String", rows, selectivity, [&] { return string_column->filter(filter, -1); });
+    }
+
+    run("permute_UInt64", rows, 0, [&] { return numeric_column->permute(permutation, 0); });
+    run("permute_String", rows, 0, [&] { return string_column->permute(permutation, 0); });
+
+    return 0;
+}
@@ -11,6 +11,7 @@
 #include <Common/memcpySmall.h>
 #include <Common/ProfileEvents.h>
 #include <Common/Allocator.h>
+#include <Common/ArenaChunkPool.h>
 
 
 namespace ProfileEvents
@@ -51,7 +52,9 @@ private:
             ProfileEvents::increment(ProfileEvents::ArenaAllocChunks);
             ProfileEvents::increment(ProfileEvents::ArenaAllocBytes, size_);
 
-            begin = reinterpret_cast<char *>(Allocator<false>::alloc(size_));
+            begin = reinterpret_cast<char *>(ArenaChunkPool::instance().tryGet(size_));
+            if (!begin)
+                begin = reinterpret_cast<char *>(Allocator<false>::alloc(size_));
             pos = begin;
             end = begin + size_ - pad_right;
             prev = prev_;
@@ -67,7 +70,8 @@ private:
             /// asan, it will correctly poison the memory by itself.
             ASAN_UNPOISON_MEMORY_REGION(begin, size());
 
-            Allocator<false>::free(begin, size());
+            if (!ArenaChunkPool::instance().tryPut(begin, size()))
+                Allocator<false>::free(begin, size());
 
             if (prev)
                 delete prev;
@@ -0,0 +1,73 @@
+#include <Common/ArenaChunkPool.h>
+#include <Common/Allocator.h>
+#include <Common/MemoryTracker.h>
+
+
+namespace DB
+{
+
+ArenaChunkPool & ArenaChunkPool::instance()
+{
+    static ArenaChunkPool pool;
+    return pool;
+}
+
+void ArenaChunkPool::setMaxBytes(size_t max_bytes_)
+{
+    std::lock_guard lock(mutex);
+    max_bytes = max_bytes_;
+}
+
+void * ArenaChunkPool::tryGet(size_t size)
+{
+    if (size < min_chunk_size_to_cache)
+        return nullptr;
+
+    std::lock_guard lock(mutex);
+
+    auto it = chunks.find(size);
+    if (it == chunks.end())
+        return nullptr;
+
+    /// Attribute the chunk to the query that takes it out of the pool. This may throw
+    /// MEMORY_LIMIT_EXCEEDED, so charge before removing the chunk: a failed charge then
+    /// leaves the pool intact instead of leaking a chunk that nobody owns.
+    CurrentMemoryTracker::alloc(size);
+
+    void * ptr = it->second.back();
+    it->second.pop_back();
+    if (it->second.empty())
+        chunks.erase(it);
+    total_bytes -= size;
+
+    return ptr;
+}
+
+bool ArenaChunkPool::tryPut(void * ptr, size_t size)
+{
+    if (size < min_chunk_size_to_cache)
+        return false;
+
+    {
+        std::lock_guard lock(mutex);
+
+        if (total_bytes + size > max_bytes)
+            return false;
+
+        chunks[size].push_back(ptr);
+        total_bytes += size;
+    }
+
+    /// The chunk no longer belongs to the releasing query.
+    CurrentMemoryTracker::free(size);
+    return true;
+}
+
+ArenaChunkPool::~ArenaChunkPool()
+{
+    for (const auto & [size, ptrs] : chunks)
+        for (void * ptr : ptrs)
+            Allocator<false>().free(ptr, size);
+}
+
+}
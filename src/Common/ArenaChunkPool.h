@@ -0,0 +1,55 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <vector>
+#include <boost/noncopyable.hpp>
+#include <common/types.h>
+
+
+namespace DB
+{
+
+/** A process-wide pool of recycled Arena chunks.
+  *
+  * Short repetitive queries allocate and release the same large chunks for
+  * aggregate states over and over, paying mmap/munmap and page faulting each
+  * time. The pool keeps released chunks (size-classed by their exact size,
+  * which repeats well because of the arenas' deterministic growth) and hands
+  * them back to the next arena asking for the same size.
+  *
+  * Memory accounting: a chunk entering the pool is released from the query's
+  * memory tracker and re-attributed to the query that takes it out, so pooled
+  * bytes behave like cache memory, bounded by the configured size.
+  *
+  * Disabled until setMaxBytes() is called with a non-zero value.
+  */
+class ArenaChunkPool : private boost::noncopyable
+{
+public:
+    static ArenaChunkPool & instance();
+
+    /// Chunks smaller than this are left to the general-purpose allocator, which caches them well.
+    static constexpr size_t min_chunk_size_to_cache = 1024 * 1024;
+
+    void setMaxBytes(size_t max_bytes_);
+
+    /// Returns a cached chunk of exactly `size` bytes, or nullptr.
+    void * tryGet(size_t size);
+
+    /// Takes ownership of the chunk and returns true, or returns false if the chunk
+    /// does not fit into the pool and must be freed by the caller.
+    bool tryPut(void * ptr, size_t size);
+
+    ~ArenaChunkPool();
+
+private:
+    ArenaChunkPool() = default;
+
+    std::mutex mutex;
+    std::map<size_t, std::vector<void *>> chunks;
+    size_t total_bytes = 0;
+    size_t max_bytes = 0;
+};
+
+}
@@ -1,11 +1,11 @@
 #pragma once
 
 #include <queue>
+#include <mutex>
+#include <chrono>
+#include <condition_variable>
 #include <type_traits>
 
-#include <Poco/Mutex.h>
-#include <Poco/Semaphore.h>
-
 #include <common/types.h>
 
 
@@ -42,117 +42,113 @@ namespace detail
 /** A very simple thread-safe queue of limited size.
   * If you try to pop an item from an empty queue, the thread is blocked until the queue becomes nonempty.
   * If you try to push an element into an overflowed queue, the thread is blocked until space appears in the queue.
+  *
+  * Implemented with a single mutex and two condition variables. Unlike the previous
+  * semaphore-based version this makes no syscalls on the uncontended path: waking is
+  * only attempted when somebody may actually be blocked.
   */
 template <typename T>
 class ConcurrentBoundedQueue
 {
 private:
     std::queue<T> queue;
-    Poco::FastMutex mutex;
-    Poco::Semaphore fill_count;
-    Poco::Semaphore empty_count;
+    mutable std::mutex mutex;
+    std::condition_variable not_full;
+    std::condition_variable not_empty;
+    const size_t max_fill;
 
 public:
-    ConcurrentBoundedQueue(size_t max_fill)
-        : fill_count(0, max_fill), empty_count(max_fill, max_fill) {}
+    explicit ConcurrentBoundedQueue(size_t max_fill_) : max_fill(max_fill_) {}
 
     void push(const T & x)
     {
-        empty_count.wait();
         {
-            Poco::ScopedLock<Poco::FastMutex> lock(mutex);
+            std::unique_lock<std::mutex> lock(mutex);
+            not_full.wait(lock, [&] { return queue.size() < max_fill; });
             queue.push(x);
         }
-        fill_count.set();
+        not_empty.notify_one();
     }
 
     template <typename... Args>
     void emplace(Args &&... args)
     {
-        empty_count.wait();
         {
-            Poco::ScopedLock<Poco::FastMutex> lock(mutex);
+            std::unique_lock<std::mutex> lock(mutex);
+            not_full.wait(lock, [&] { return queue.size() < max_fill; });
             queue.emplace(std::forward<Args>(args)...);
         }
-        fill_count.set();
+        not_empty.notify_one();
     }
 
     void pop(T & x)
     {
-        fill_count.wait();
         {
-            Poco::ScopedLock<Poco::FastMutex> lock(mutex);
+            std::unique_lock<std::mutex> lock(mutex);
+            not_empty.wait(lock, [&] { return !queue.empty(); });
             detail::moveOrCopyIfThrow(std::move(queue.front()), x);
             queue.pop();
         }
-        empty_count.set();
+        not_full.notify_one();
     }
 
     bool tryPush(const T & x, UInt64 milliseconds = 0)
     {
-        if (empty_count.tryWait(milliseconds))
         {
-            {
-                Poco::ScopedLock<Poco::FastMutex> lock(mutex);
-                queue.push(x);
-            }
-            fill_count.set();
-            return true;
+            std::unique_lock<std::mutex> lock(mutex);
+            if (!not_full.wait_for(lock, std::chrono::milliseconds(milliseconds), [&] { return queue.size() < max_fill; }))
+                return false;
+            queue.push(x);
         }
-        return false;
+        not_empty.notify_one();
+        return true;
     }
 
     template <typename... Args>
     bool tryEmplace(UInt64 milliseconds, Args &&... args)
     {
-        if (empty_count.tryWait(milliseconds))
         {
-            {
-                Poco::ScopedLock<Poco::FastMutex> lock(mutex);
-                queue.emplace(std::forward<Args>(args)...);
-            }
-            fill_count.set();
-            return true;
+            std::unique_lock<std::mutex> lock(mutex);
+            if (!not_full.wait_for(lock, std::chrono::milliseconds(milliseconds), [&] { return queue.size() < max_fill; }))
+                return false;
+            queue.emplace(std::forward<Args>(args)...);
         }
-        return false;
+        not_empty.notify_one();
+        return true;
     }
 
     bool tryPop(T & x, UInt64 milliseconds = 0)
     {
-        if (fill_count.tryWait(milliseconds))
         {
-            {
-                Poco::ScopedLock<Poco::FastMutex> lock(mutex);
-                detail::moveOrCopyIfThrow(std::move(queue.front()), x);
-                queue.pop();
-            }
-            empty_count.set();
-            return true;
+            std::unique_lock<std::mutex> lock(mutex);
+            if (!not_empty.wait_for(lock, std::chrono::milliseconds(milliseconds), [&] { return !queue.empty(); }))
+                return false;
+            detail::moveOrCopyIfThrow(std::move(queue.front()), x);
+            queue.pop();
         }
-        return false;
+        not_full.notify_one();
+        return true;
     }
 
-    size_t size()
+    size_t size() const
     {
-        Poco::ScopedLock<Poco::FastMutex> lock(mutex);
+        std::lock_guard<std::mutex> lock(mutex);
         return queue.size();
     }
 
-    size_t empty()
+    bool empty() const
     {
-        Poco::ScopedLock<Poco::FastMutex> lock(mutex);
+        std::lock_guard<std::mutex> lock(mutex);
         return queue.empty();
     }
 
     void clear()
     {
-        while (fill_count.tryWait(0))
         {
-            {
-                Poco::ScopedLock<Poco::FastMutex> lock(mutex);
-                queue.pop();
-            }
-            empty_count.set();
+            std::lock_guard<std::mutex> lock(mutex);
+            std::queue<T> empty_queue;
+            queue.swap(empty_queue);
         }
+        not_full.notify_all();
     }
 };
@@ -41,6 +41,12 @@ public:
             ++this->m_size;
         }
 
+        /// The union is at least as large as the larger of the two sets, so grow to that size
+        /// upfront instead of rehashing repeatedly while elements are inserted one by one.
+        /// (Unlike size() + rhs.size(), this never overestimates, whatever the overlap is.)
+        if (size_t min_result_size = std::max(this->size(), rhs.size()))
+            this->resize(min_result_size);
+
         for (size_t i = 0; i < rhs.grower.bufSize(); ++i)
             if (!rhs.buf[i].isZero(*this))
                 this->insert(rhs.buf[i].getValue());
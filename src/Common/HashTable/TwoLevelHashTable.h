@@ -116,6 +116,12 @@ public:
         }
     }
 
+    /// Hint the CPU to load the cell where a key with this hash would be placed.
+    void ALWAYS_INLINE prefetch(size_t hash_value) const
+    {
+        impls[getBucketFromHash(hash_value)].prefetch(hash_value);
+    }
+
 
     class iterator
     {
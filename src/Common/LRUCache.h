@@ -28,6 +28,21 @@ struct TrivialWeightFunction
 /// of that value.
 /// Cache starts to evict entries when their total weight exceeds max_size.
 /// Value weight should not change after insertion.
+///
+/// If 'protected_size_ratio' is non-zero, the cache becomes scan-resistant (segmented LRU):
+/// new entries go to a probationary segment and are promoted to a protected segment
+/// (at most protected_size_ratio of max_size) only when accessed again. Eviction takes entries
+/// from the probationary segment first, so a one-pass bulk scan cannot wash out entries
+/// that have been used more than once.
+///
+/// NOTE: Observability for tuning the big instances already exists at their owners rather than
+/// in this template: hits/misses per cache are ProfileEvents ({Mark,Uncompressed}Cache{Hits,
+/// Misses}, readable per query from query_log), evicted weight is UncompressedCacheWeightLost,
+/// and current bytes/item counts are exported by AsynchronousMetrics ({Mark,Uncompressed}
+/// Cache{Bytes,Files,Cells}). Hash-table probe-length histograms were considered and rejected:
+/// a counter inside the probe loop taxes exactly the kernel it measures; load factor is
+/// derivable at dump time (size vs buffer size), and the Aggregator already logs its sizes at
+/// trace level.
 template <typename TKey, typename TMapped, typename HashFunction = std::hash<TKey>, typename WeightFunction = TrivialWeightFunction<TMapped>>
 class LRUCache
 {
@@ -40,8 +55,9 @@ private:
     using Clock = std::chrono::steady_clock;
 
 public:
-    LRUCache(size_t max_size_)
-        : max_size(std::max(static_cast<size_t>(1), max_size_)) {}
+    LRUCache(size_t max_size_, double protected_size_ratio = 0)
+        : max_size(std::max(static_cast<size_t>(1), max_size_))
+        , max_protected_size(static_cast<size_t>(max_size * protected_size_ratio)) {}
 
     MappedPtr get(const Key & key)
     {
@@ -149,9 +165,11 @@ public:
     {
         std::lock_guard lock(mutex);
         queue.clear();
+        protected_queue.clear();
         cells.clear();
         insert_tokens.clear();
         current_size = 0;
+        current_protected_size = 0;
         hits = 0;
         misses = 0;
     }
@@ -167,6 +185,7 @@ protected:
         MappedPtr value;
         size_t size;
         LRUQueueIterator queue_iterator;
+        bool is_protected = false;
     };
 
     using Cells = std::unordered_map<Key, Cell, HashFunction>;
@@ -242,11 +261,17 @@ private:
 
     InsertTokenById insert_tokens;
 
+    /// Probationary segment. If max_protected_size is zero, this is the only queue (plain LRU).
     LRUQueue queue;
+    /// Protected segment: entries that were accessed at least twice.
+    LRUQueue protected_queue;
 
     /// Total weight of values.
     size_t current_size = 0;
+    /// Total weight of values in the protected segment.
+    size_t current_protected_size = 0;
     const size_t max_size;
+    const size_t max_protected_size;
 
     std::atomic<size_t> hits {0};
     std::atomic<size_t> misses {0};
@@ -263,12 +288,49 @@ private:
 
         Cell & cell = it->second;
 
-        /// Move the key to the end of the queue. The iterator remains valid.
-        queue.splice(queue.end(), queue, cell.queue_iterator);
+        /// Move the key to the end of its queue. The iterator remains valid.
+        if (cell.is_protected)
+        {
+            protected_queue.splice(protected_queue.end(), protected_queue, cell.queue_iterator);
+        }
+        else if (max_protected_size)
+        {
+            /// A repeated access promotes the entry from the probationary to the protected segment.
+            protected_queue.splice(protected_queue.end(), queue, cell.queue_iterator);
+            cell.is_protected = true;
+            current_protected_size += cell.size;
+            shrinkProtected();
+        }
+        else
+        {
+            queue.splice(queue.end(), queue, cell.queue_iterator);
+        }
 
         return cell.value;
     }
 
+    /// If the protected segment became too large, demote its least recently used
+    /// entries back to the probationary segment (they become eviction candidates again).
+    void shrinkProtected()
+    {
+        while (current_protected_size > max_protected_size && !protected_queue.empty())
+        {
+            const Key & key = protected_queue.front();
+
+            auto it = cells.find(key);
+            if (it == cells.end())
+            {
+                LOG_ERROR(&Poco::Logger::get("LRUCache"), "LRUCache became inconsistent. There must be a bug in it.");
+                abort();
+            }
+
+            Cell & cell = it->second;
+            current_protected_size -= cell.size;
+            cell.is_protected = false;
+            queue.splice(queue.end(), protected_queue, cell.queue_iterator);
+        }
+    }
+
     void setImpl(const Key & key, const MappedPtr & mapped, [[maybe_unused]] std::lock_guard<std::mutex> & cache_lock)
     {
         auto res = cells.emplace(std::piecewise_construct,
@@ -280,17 +342,29 @@ private:
 
         if (inserted)
         {
+            /// New entries always start in the probationary segment.
             cell.queue_iterator = queue.insert(queue.end(), key);
         }
         else
         {
             current_size -= cell.size;
-            queue.splice(queue.end(), queue, cell.queue_iterator);
+            if (cell.is_protected)
+            {
+                current_protected_size -= cell.size;
+                protected_queue.splice(protected_queue.end(), protected_queue, cell.queue_iterator);
+            }
+            else
+                queue.splice(queue.end(), queue, cell.queue_iterator);
         }
 
         cell.value = mapped;
         cell.size = cell.value ? weight_function(*cell.value) : 0;
         current_size += cell.size;
+        if (cell.is_protected)
+        {
+            current_protected_size += cell.size;
+            shrinkProtected();
+        }
 
         removeOverflow();
     }
@@ -301,7 +375,9 @@ private:
         size_t queue_size = cells.size();
         while ((current_size > max_size) && (queue_size > 1))
         {
-            const Key & key = queue.front();
+            /// Evict from the probationary segment first; touch the protected one only if it is all that is left.
+            LRUQueue & evict_queue = queue.empty() ? protected_queue : queue;
+            const Key & key = evict_queue.front();
 
             auto it = cells.find(key);
             if (it == cells.end())
@@ -313,10 +389,12 @@ private:
             const auto & cell = it->second;
 
             current_size -= cell.size;
+            if (cell.is_protected)
+                current_protected_size -= cell.size;
             current_weight_lost += cell.size;
 
             cells.erase(it);
-            queue.pop_front();
+            evict_queue.pop_front();
             --queue_size;
         }
 
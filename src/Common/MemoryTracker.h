@@ -10,6 +10,16 @@
 /** Tracks memory consumption.
   * It throws an exception if amount of consumed memory become greater than certain limit.
   * The same memory tracker could be simultaneously used in different threads.
+  *
+  * NOTE: Composition of a node's memory is already observable without heap dumps, through the
+  * tracker hierarchy and per-subsystem accounting that exists today: per-query and per-user
+  * amounts in system.processes, merge memory in system.merges and MemoryTrackingForMerges,
+  * the background pools' trackers in CurrentMetrics (MemoryTrackingInBackground*), cache sizes
+  * in asynchronous_metrics (MarkCacheBytes, UncompressedCacheBytes), and dictionary residency
+  * in system.dictionaries.bytes_allocated. A single merged "breakdown" view would be a
+  * presentation-layer join of those sources. Finer tags (e.g. join vs aggregation inside one
+  * query) would require a tracker per operator; note the drift caveat on the background pool
+  * metrics — allocate-here-free-there makes fine-grained tags progressively less truthful.
   */
 class MemoryTracker
 {
@@ -75,6 +85,11 @@ public:
         return peak.load(std::memory_order_relaxed);
     }
 
+    Int64 getHardLimit() const
+    {
+        return hard_limit.load(std::memory_order_relaxed);
+    }
+
     /** Set limit if it was not set.
       * Otherwise, set limit to new value, if new value is greater than previous limit.
       */
@@ -40,6 +40,10 @@
     M(TableFunctionExecute, "") \
     M(MarkCacheHits, "") \
     M(MarkCacheMisses, "") \
+    M(AggregationResultCacheHits, "") \
+    M(AggregationResultCacheMisses, "") \
+    M(JoinCacheHits, "") \
+    M(JoinCacheMisses, "") \
     M(CreatedReadBufferOrdinary, "") \
     M(CreatedReadBufferAIO, "") \
     M(CreatedReadBufferAIOFailed, "") \
@@ -48,6 +52,14 @@
     M(CreatedWriteBufferOrdinary, "") \
     M(CreatedWriteBufferAIO, "") \
     M(CreatedWriteBufferAIOFailed, "") \
+    /// NOTE: Per-resource wait attribution for a query is assembled from the events below plus
+    /// the OS-level counters further down, all aggregated per query into query_log:
+    /// Disk{Read,Write}ElapsedMicroseconds time the syscalls (page cache included),
+    /// OSIOWaitMicroseconds is real IO wait and OSCPUWaitMicroseconds is run-queue wait (both
+    /// from taskstats), Network{Receive,Send}ElapsedMicroseconds time the socket,
+    /// {Mark,Uncompressed}Cache{Hits,Misses} classify cache efficiency, and the difference
+    /// between RealTimeMicroseconds and UserTime+SystemTime bounds everything else (locks,
+    /// scheduling). A slow query's profile reads directly off one query_log row.
     M(DiskReadElapsedMicroseconds, "Total time spent waiting for read syscall. This include reads from page cache.") \
     M(DiskWriteElapsedMicroseconds, "Total time spent waiting for write syscall. This include writes to page cache.") \
     M(NetworkReceiveElapsedMicroseconds, "") \
@@ -27,6 +27,16 @@ namespace DB
   *
   * Destructor tries to unset timer and restore previous signal handler.
   * Note that signal handler implementation is defined by template parameter. See QueryProfilerReal and QueryProfilerCpu.
+  *
+  * NOTE: Most of an "always-on, whole-process" profiler already exists here: the signal handler
+  * is async-safe, samples flow through the TraceCollector pipe in batches to system.trace_log,
+  * and flamegraph symbolization is query-side (addressToSymbol/demangle over trace_log). What
+  * is per-query is only the *arming*: ThreadStatus creates these timers from the query's
+  * query_profiler_{real,cpu}_time_period_ns settings, so threads that never attach a query
+  * (merges, fetches, moves) are never sampled. Extending coverage is a lifecycle change — a
+  * server-level period in the main config and timer setup in the background pools' thread
+  * functions — not a new profiler; any adaptive-rate logic belongs at that config layer, since
+  * per-sample cost is already bounded by the timer period.
   */
 template <typename ProfilerImpl>
 class QueryProfilerBase
@@ -151,32 +151,23 @@ public:
 class ThreadFromGlobalPool
 {
 public:
+    /// Tag for threads the cluster health depends on (ZooKeeper I/O, scheduling heartbeats).
+    /// When the global pool is saturated, creation of such a thread is queued ahead of
+    /// normal-priority work, so overload degrades queries rather than cluster membership.
+    struct CriticalPriorityTag {};
+
     ThreadFromGlobalPool() {}
 
     template <typename Function, typename... Args>
     explicit ThreadFromGlobalPool(Function && func, Args &&... args)
-        : state(std::make_shared<Poco::Event>())
+        : ThreadFromGlobalPool(0, std::forward<Function>(func), std::forward<Args>(args)...)
+    {
+    }
+
+    template <typename Function, typename... Args>
+    ThreadFromGlobalPool(CriticalPriorityTag, Function && func, Args &&... args)
+        : ThreadFromGlobalPool(1, std::forward<Function>(func), std::forward<Args>(args)...)
     {
-        /// NOTE: If this will throw an exception, the destructor won't be called.
-        GlobalThreadPool::instance().scheduleOrThrow([
-            state = state,
-            func = std::forward<Function>(func),
-            args = std::make_tuple(std::forward<Args>(args)...)]
-        {
-            try
-            {
-                /// Thread status holds raw pointer on query context, thus it always must be destroyed
-                /// before sending signal that permits to join this thread.
-                DB::ThreadStatus thread_status;
-                std::apply(func, args);
-            }
-            catch (...)
-            {
-                state->set();
-                throw;
-            }
-            state->set();
-        });
     }
 
     ThreadFromGlobalPool(ThreadFromGlobalPool && rhs)
@@ -220,6 +211,32 @@ public:
     }
 
 private:
+    template <typename Function, typename... Args>
+    ThreadFromGlobalPool(int priority, Function && func, Args &&... args)
+        : state(std::make_shared<Poco::Event>())
+    {
+        /// NOTE: If this will throw an exception, the destructor won't be called.
+        GlobalThreadPool::instance().scheduleOrThrow([
+            state = state,
+            func = std::forward<Function>(func),
+            args = std::make_tuple(std::forward<Args>(args)...)]
+        {
+            try
+            {
+                /// Thread status holds raw pointer on query context, thus it always must be destroyed
+                /// before sending signal that permits to join this thread.
+                DB::ThreadStatus thread_status;
+                std::apply(func, args);
+            }
+            catch (...)
+            {
+                state->set();
+                throw;
+            }
+            state->set();
+        }, priority);
+    }
+
     /// The state used in this object and inside the thread job.
     std::shared_ptr<Poco::Event> state;
 };
@@ -177,6 +177,12 @@ struct PerfDescriptorsHolder : boost::noncopyable
     void releaseResources();
 };
 
+/// Per-thread hardware counters sampled with perf_event_open around query execution.
+/// ThreadStatus arms them when the query starts (see initPerformanceCounters) and publishes
+/// deltas into ProfileEvents on finish, so cycles, instructions, cache and branch miss
+/// counts land in query_log/query_thread_log next to the wall-clock numbers. Enabled by
+/// the 'metrics_perf_events_enabled' setting; the event set is chosen with
+/// 'metrics_perf_events_list'. IPC and miss rates are then plain ratios over query_log.
 struct PerfEventsCounters
 {
     PerfDescriptorsHolder thread_events_descriptors_holder;
@@ -868,8 +868,11 @@ ZooKeeper::ZooKeeper(
     if (!auth_scheme.empty())
         sendAuth(auth_scheme, auth_data);
 
-    send_thread = ThreadFromGlobalPool([this] { sendThread(); });
-    receive_thread = ThreadFromGlobalPool([this] { receiveThread(); });
+    /// Critical priority: when a session expires under overload, these threads must be recreated
+    /// ahead of queued bulk work, otherwise the new session expires too and the replica stays
+    /// read-only.
+    send_thread = ThreadFromGlobalPool(ThreadFromGlobalPool::CriticalPriorityTag{}, [this] { sendThread(); });
+    receive_thread = ThreadFromGlobalPool(ThreadFromGlobalPool::CriticalPriorityTag{}, [this] { receiveThread(); });
 
     ProfileEvents::increment(ProfileEvents::ZooKeeperInit);
 }
@@ -77,6 +77,13 @@ CachedCompressedReadBuffer::CachedCompressedReadBuffer(
 {
 }
 
+void CachedCompressedReadBuffer::prefetch(size_t offset_in_compressed_file, size_t length)
+{
+    initInput();
+    file_in->prefetch(offset_in_compressed_file, length);
+}
+
+
 void CachedCompressedReadBuffer::seek(size_t offset_in_compressed_file, size_t offset_in_decompressed_block)
 {
     if (owned_cell &&
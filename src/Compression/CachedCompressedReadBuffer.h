@@ -42,6 +42,9 @@ public:
 
     void seek(size_t offset_in_compressed_file, size_t offset_in_decompressed_block);
 
+    /// Hint the OS to read ahead the given range of the compressed file.
+    void prefetch(size_t offset_in_compressed_file, size_t length);
+
     void setProfileCallback(const ReadBufferFromFileBase::ProfileCallback & profile_callback_, clockid_t clock_type_ = CLOCK_MONOTONIC_COARSE)
     {
         profile_callback = profile_callback_;
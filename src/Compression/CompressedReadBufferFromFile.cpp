@@ -2,6 +2,7 @@
 
 #include "CompressedReadBufferFromFile.h"
 
+#include <Compression/CompressionInfo.h>
 #include <Compression/LZ4_decompress_faster.h>
 #include <IO/WriteHelpers.h>
 #include <IO/createReadBufferFromFileBase.h>
@@ -28,6 +29,17 @@ bool CompressedReadBufferFromFile::nextImpl()
     /// This is for clang static analyzer.
     assert(size_decompressed + additional_size_at_the_end_of_buffer > 0);
 
+    /// If the data is not compressed and the whole block resides in the 'file_in' buffer
+    /// (always the case for mmapped files), serve it from there directly instead of
+    /// copying into own memory. The bytes stay intact until the next block is read.
+    if (codec->getMethodByte() == static_cast<uint8_t>(CompressionMethodByte::NONE)
+        && compressed_buffer != own_compressed_buffer.data())
+    {
+        UInt8 header_size = ICompressionCodec::getHeaderSize();
+        working_buffer = Buffer(compressed_buffer + header_size, compressed_buffer + header_size + size_decompressed);
+        return true;
+    }
+
     memory.resize(size_decompressed + additional_size_at_the_end_of_buffer);
     working_buffer = Buffer(memory.data(), &memory[size_decompressed]);
 
@@ -11,6 +11,14 @@ namespace DB
 
 
 /// Unlike CompressedReadBuffer, it can do seek.
+///
+/// Blocks are decompressed one at a time on the calling thread, although compressed blocks
+/// are independent and could be decompressed ahead on a helper pool. This is intentional:
+/// the main consumers (MergeTreeReaderStream and the mark-based seek() below) jump between
+/// granules, so speculatively decompressed blocks would mostly be thrown away, and for plain
+/// sequential scans the query pipeline already gets parallelism by splitting mark ranges
+/// across streams. Decompression read-ahead would only pay off for a strictly linear
+/// single-stream consumer, which none of the current callers is.
 class CompressedReadBufferFromFile : public CompressedReadBufferBase, public BufferWithOwnMemory<ReadBuffer>
 {
 private:
@@ -37,6 +45,12 @@ public:
 
     size_t readBig(char * to, size_t n) override;
 
+    /// Hint the OS to read ahead the given range of the compressed file.
+    void prefetch(size_t offset_in_compressed_file, size_t length)
+    {
+        file_in.prefetch(offset_in_compressed_file, length);
+    }
+
     void setProfileCallback(const ReadBufferFromFileBase::ProfileCallback & profile_callback_, clockid_t clock_type_ = CLOCK_MONOTONIC_COARSE)
     {
         file_in.setProfileCallback(profile_callback_, clock_type_);
@@ -158,11 +158,13 @@ BackgroundSchedulePool::BackgroundSchedulePool(size_t size_, CurrentMetrics::Met
 {
     LOG_INFO(&Poco::Logger::get("BackgroundSchedulePool/" + thread_name), "Create BackgroundSchedulePool with {} threads", size);
 
+    /// Scheduled tasks include replication keepalives and leadership checks; do not let their
+    /// threads queue behind bulk work if the global pool happens to be saturated at creation time.
     threads.resize(size);
     for (auto & thread : threads)
-        thread = ThreadFromGlobalPool([this] { threadFunction(); });
+        thread = ThreadFromGlobalPool(ThreadFromGlobalPool::CriticalPriorityTag{}, [this] { threadFunction(); });
 
-    delayed_thread = ThreadFromGlobalPool([this] { delayExecutionThreadFunction(); });
+    delayed_thread = ThreadFromGlobalPool(ThreadFromGlobalPool::CriticalPriorityTag{}, [this] { delayExecutionThreadFunction(); });
 }
 
 
@@ -274,6 +274,17 @@ private:
                                         CompareInt scale)
     {
         size_t size = a.size();
+
+        /// Same-scale decimal comparison cannot overflow (CompareInt is the wider of the two
+        /// native types and no scaling is applied), but apply() is NO_INLINE and an opaque call
+        /// per element keeps this hot loop from vectorizing. Compare directly.
+        if constexpr (!scale_left && !scale_right && !is_big_int_v<CompareInt> && IsDecimalNumber<A> && IsDecimalNumber<B>)
+        {
+            for (size_t i = 0; i < size; ++i)
+                c[i] = Op::apply(bigint_cast<CompareInt>(a[i]), bigint_cast<CompareInt>(b[i]));
+            return;
+        }
+
         const A * a_pos = a.data();
         const B * b_pos = b.data();
         UInt8 * c_pos = c.data();
@@ -292,6 +303,15 @@ private:
     static void NO_INLINE vectorConstant(const ArrayA & a, B b, PaddedPODArray<UInt8> & c, CompareInt scale)
     {
         size_t size = a.size();
+
+        if constexpr (!scale_left && !scale_right && !is_big_int_v<CompareInt> && IsDecimalNumber<A> && IsDecimalNumber<B>)
+        {
+            const CompareInt b_int = bigint_cast<CompareInt>(b);
+            for (size_t i = 0; i < size; ++i)
+                c[i] = Op::apply(bigint_cast<CompareInt>(a[i]), b_int);
+            return;
+        }
+
         const A * a_pos = a.data();
         UInt8 * c_pos = c.data();
         const A * a_end = a_pos + size;
@@ -308,6 +328,15 @@ private:
     static void NO_INLINE constantVector(A a, const ArrayB & b, PaddedPODArray<UInt8> & c, CompareInt scale)
     {
         size_t size = b.size();
+
+        if constexpr (!scale_left && !scale_right && !is_big_int_v<CompareInt> && IsDecimalNumber<A> && IsDecimalNumber<B>)
+        {
+            const CompareInt a_int = bigint_cast<CompareInt>(a);
+            for (size_t i = 0; i < size; ++i)
+                c[i] = Op::apply(a_int, bigint_cast<CompareInt>(b[i]));
+            return;
+        }
+
         const B * b_pos = b.data();
         UInt8 * c_pos = c.data();
         const B * b_end = b_pos + size;
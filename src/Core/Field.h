@@ -229,6 +229,16 @@ struct NearestFieldTypeImpl<T, std::enable_if_t<std::is_enum_v<T>>>
   *
   * Used to represent a single value of one of several types in memory.
   * Warning! Prefer to use chunks of columns instead of single values. See Column.h
+  *
+  * NOTE: Field owns its String/Array payloads by value deliberately. Backing them with a
+  * query-lifetime bump allocator was considered and rejected: Fields routinely escape the
+  * query that created them — they sit in Settings, in ASTLiterals cached with prepared sets,
+  * in table/dictionary metadata and in blocks handed to background threads — so wholesale
+  * free at query end would dangle those owners, and tracking which Fields escaped is
+  * equivalent to the individual ownership we have now. The effective mitigation is the
+  * warning above: hot paths keep data in columns (one allocation per block), and the parser
+  * collapses big literal lists into a single Field (see ParserCollectionOfLiterals), leaving
+  * per-query Field churn proportional to query text size.
   */
 class Field
 {
@@ -100,6 +100,17 @@ namespace Protocol
     }
 
     /// Packet types that client transmits.
+    ///
+    /// NOTE: A "query batch" packet (N independent queries in one request, results streamed back
+    /// tagged per query) has been proposed for point-lookup workloads and rejected. The protocol
+    /// is strictly one query in flight per connection, and the server relies on that: progress,
+    /// totals, profile info and logs packets are unattributed, cancellation addresses "the"
+    /// current query, and TCPHandler's QueryState is a singleton per connection. Multiplexing
+    /// means tagging every server packet and reworking state/cancel handling across all clients —
+    /// a protocol version break, not an extension. The per-query cost it would amortize is better
+    /// reduced directly: keep connections open (Hello/handshake is already once per connection)
+    /// and batch lookups into one query (IN tuples / temporary table join), which also lets the
+    /// server use one index pass instead of N.
     namespace Client
     {
         enum Enum
@@ -43,6 +43,7 @@ class IColumn;
     M(UInt64, max_joined_block_size_rows, DEFAULT_BLOCK_SIZE, "Maximum block size for JOIN result (if join algorithm supports it). 0 means unlimited.", 0) \
     M(UInt64, max_insert_threads, 0, "The maximum number of threads to execute the INSERT SELECT query. Values 0 or 1 means that INSERT SELECT is not run in parallel. Higher values will lead to higher memory usage. Parallel INSERT SELECT has effect only if the SELECT part is run on parallel, see 'max_threads' setting.", 0) \
     M(UInt64, max_final_threads, 16, "The maximum number of threads to read from table with FINAL.", 0) \
+    M(Bool, do_not_merge_across_partitions_select_final, false, "Merge parts only in one partition in SELECT FINAL, and skip merging for partitions consisting of a single already-merged part. Rows with equal sorting key in different partitions are not collapsed.", 0) \
     M(MaxThreads, max_threads, 0, "The maximum number of threads to execute the request. By default, it is determined automatically.", 0) \
     M(MaxThreads, max_alter_threads, 0, "The maximum number of threads to execute the ALTER requests. By default, it is determined automatically.", 0) \
     M(UInt64, max_read_buffer_size, DBMS_DEFAULT_BUFFER_SIZE, "The maximum size of the buffer to read from the filesystem.", 0) \
@@ -77,7 +78,7 @@ class IColumn;
     M(Milliseconds, distributed_directory_monitor_sleep_time_ms, 100, "Sleep time for StorageDistributed DirectoryMonitors, in case of any errors delay grows exponentially.", 0) \
     M(Milliseconds, distributed_directory_monitor_max_sleep_time_ms, 30000, "Maximum sleep time for StorageDistributed DirectoryMonitors, it limits exponential growth too.", 0) \
     \
-    M(Bool, distributed_directory_monitor_batch_inserts, false, "Should StorageDistributed DirectoryMonitors try to batch individual inserts into bigger ones.", 0) \
+    M(Bool, distributed_directory_monitor_batch_inserts, true, "Should StorageDistributed DirectoryMonitors try to batch individual inserts into bigger ones. Batches are recorded in current_batch.txt and re-sent as-is after a failure, so deduplication on replicated destinations keeps working.", 0) \
     \
     M(Bool, optimize_move_to_prewhere, true, "Allows disabling WHERE to PREWHERE optimization in SELECT queries from MergeTree.", 0) \
     \
@@ -120,11 +121,14 @@ class IColumn;
     \
     M(UInt64, merge_tree_min_rows_for_concurrent_read, (20 * 8192), "If at least as many lines are read from one file, the reading can be parallelized.", 0) \
     M(UInt64, merge_tree_min_bytes_for_concurrent_read, (24 * 10 * 1024 * 1024), "If at least as many bytes are read from one file, the reading can be parallelized.", 0) \
+    M(Bool, merge_tree_adaptive_read_streams, false, "Size the number of parallel read streams from the amount of marks to read instead of always using max_threads, so that each stream gets at least merge_tree_min_rows(bytes)_for_concurrent_read worth of data.", 0) \
+    M(UInt64, merge_tree_min_read_streams, 1, "The lower bound on the number of parallel read streams when merge_tree_adaptive_read_streams is enabled.", 0) \
     M(UInt64, merge_tree_min_rows_for_seek, 0, "You can skip reading more than that number of rows at the price of one seek per file.", 0) \
     M(UInt64, merge_tree_min_bytes_for_seek, 0, "You can skip reading more than that number of bytes at the price of one seek per file.", 0) \
     M(UInt64, merge_tree_coarse_index_granularity, 8, "If the index segment can contain the required keys, divide it into as many parts and recursively check them.", 0) \
     M(UInt64, merge_tree_max_rows_to_use_cache, (128 * 8192), "The maximum number of rows per request, to use the cache of uncompressed data. If the request is large, the cache is not used. (For large queries not to flush out the cache.)", 0) \
     M(UInt64, merge_tree_max_bytes_to_use_cache, (192 * 10 * 1024 * 1024), "The maximum number of bytes per request, to use the cache of uncompressed data. If the request is large, the cache is not used. (For large queries not to flush out the cache.)", 0) \
+    M(Bool, merge_tree_sample_granules, false, "Implement SAMPLE by deterministically selecting whole granules to read instead of filtering rows by the sampling key. Reduces I/O proportionally to the sample ratio, at the cost of sampling whole granules rather than individual rows.", 0) \
     \
     M(UInt64, mysql_max_rows_to_insert, 65536, "The maximum number of rows in MySQL batch insertion of the MySQL storage engine", 0) \
     \
@@ -132,7 +136,9 @@ class IColumn;
     \
     M(UInt64, min_bytes_to_use_direct_io, 0, "The minimum number of bytes for reading the data with O_DIRECT option during SELECT queries execution. 0 - disabled.", 0) \
     M(UInt64, min_bytes_to_use_mmap_io, 0, "The minimum number of bytes for reading the data with mmap option during SELECT queries execution. 0 - disabled.", 0) \
+    M(Bool, merge_tree_prefetch_column_streams, true, "Hint the OS to read ahead compressed data of all column streams of a wide MergeTree part before deserializing the next mark range. Has effect only for reads from a local filesystem.", 0) \
     \
+    M(Bool, use_column_minmax_statistics, true, "Use per-column min/max statistics stored in parts (if any) to skip whole parts by conditions on non-key columns.", 0) \
     M(Bool, force_index_by_date, 0, "Throw an exception if there is a partition key in a table, and it is not used.", 0) \
     M(Bool, force_primary_key, 0, "Throw an exception if there is primary key in a table, and it is not used.", 0) \
     \
@@ -144,6 +150,7 @@ class IColumn;
     M(Int64, network_zstd_compression_level, 1, "Allows you to select the level of ZSTD compression.", 0) \
     \
     M(UInt64, priority, 0, "Priority of the query. 1 - the highest, higher value - lower priority; 0 - do not use priorities.", 0) \
+    M(Milliseconds, priority_preemption_timeout_ms, 1000, "While queries of higher priority are running, a preempted query is unfrozen this often to process one block. Smaller values give preempted queries a larger CPU share.", 0) \
     M(Int64, os_thread_priority, 0, "If non zero - set corresponding 'nice' value for query processing threads. Can be used to adjust query priority for OS scheduler.", 0) \
     \
     M(Bool, log_queries, 1, "Log requests and write the log to the system table.", 0) \
@@ -234,6 +241,10 @@ class IColumn;
     M(UInt64, max_rows_to_group_by, 0, "", 0) \
     M(OverflowModeGroupBy, group_by_overflow_mode, OverflowMode::THROW, "What to do when the limit is exceeded.", 0) \
     M(UInt64, max_bytes_before_external_group_by, 0, "", 0) \
+    M(Float, max_bytes_ratio_before_external_group_by, 0., "Start flushing aggregation data to disk when query memory usage exceeds this share of the query memory limit. Used when max_bytes_before_external_group_by is not set. 0 - disabled.", 0) \
+    M(Bool, aggregation_two_level_merge, false, "Convert single-level aggregation states to two-level before the final merge, so that the merge runs in parallel over buckets even when the hash tables are small.", 0) \
+    M(Bool, use_aggregation_result_cache, false, "Use cache of finalized results of aggregation queries over MergeTree tables (enabled on the server by the aggregation_result_cache_size config). Entries are keyed by the query text, the user and row policy, the changed settings and the set of data parts of the main table; queries calling non-deterministic functions are never cached.", 0) \
+    M(Bool, use_join_cache, false, "Share built hash join tables between queries that JOIN the same MergeTree table with the same subquery (enabled on the server by the join_cache_size config). Only INNER and LEFT hash joins are shared; entries are invalidated by changes of the table's data parts.", 0) \
     \
     M(UInt64, max_rows_to_sort, 0, "", 0) \
     M(UInt64, max_bytes_to_sort, 0, "", 0) \
@@ -324,6 +335,7 @@ class IColumn;
     M(Bool, enable_unaligned_array_join, false, "Allow ARRAY JOIN with multiple arrays that have different sizes. When this settings is enabled, arrays will be resized to the longest one.", 0) \
     M(Bool, optimize_read_in_order, true, "Enable ORDER BY optimization for reading data in corresponding order in MergeTree tables.", 0) \
     M(Bool, optimize_aggregation_in_order, false, "Enable GROUP BY optimization for aggregating data in corresponding order in MergeTree tables.", 0) \
+    M(Bool, optimize_join_swap_tables, true, "For a simple INNER JOIN of two plain tables, put the one with less total rows to the right (build) side regardless of query text order.", 0) \
     M(UInt64, read_in_order_two_level_merge_threshold, 100, "Minimal number of parts to read to run preliminary merge step during multithread reading in order of primary key.", 0) \
     M(Bool, low_cardinality_allow_in_native_format, true, "Use LowCardinality type in Native format. Otherwise, convert LowCardinality columns to ordinary for select query, and convert ordinary columns to required LowCardinality for insert query.", 0) \
     M(Bool, cancel_http_readonly_queries_on_client_close, false, "Cancel HTTP readonly queries when a client closes the connection without waiting for response.", 0) \
@@ -357,6 +369,7 @@ class IColumn;
     M(Bool, optimize_duplicate_order_by_and_distinct, true, "Remove duplicate ORDER BY and DISTINCT if it's possible", 0) \
     M(Bool, optimize_redundant_functions_in_order_by, true, "Remove functions from ORDER BY if its argument is also in ORDER BY", 0) \
     M(Bool, optimize_if_chain_to_multiif, false, "Replace if(cond1, then1, if(cond2, ...)) chains to multiIf. Currently it's not beneficial for numeric types.", 0) \
+    M(Bool, optimize_or_like_chain, false, "Replace two or more OR-ed LIKEs over the same expression with a single multiMatchAny. Disabled by default because it defeats index analysis over key columns.", 0) \
     M(Bool, optimize_if_transform_strings_to_enum, false, "Replaces string-type arguments in If and Transform to enum. Disabled by default cause it could make inconsistent change in distributed query that would lead to its fail.", 0) \
     M(Bool, optimize_monotonous_functions_in_order_by, true, "Replace monotonous function with its argument in ORDER BY", 0) \
     M(Bool, allow_experimental_alter_materialized_view_structure, false, "Allow atomic alter on Materialized views. Work in progress.", 0) \
@@ -471,6 +484,16 @@ DECLARE_SETTINGS_TRAITS_ALLOW_CUSTOM_SETTINGS(SettingsTraits, LIST_OF_SETTINGS)
 
 /** Settings of query execution.
   * These settings go to users.xml.
+  *
+  * NOTE: The struct is a flat value type on purpose, and copying it per query (and per shard
+  * context in Distributed queries) is the intended cost model: reading a setting on hot paths
+  * — which happens per block all over execution — is a direct field access with no
+  * indirection, no hash lookup and no shared state. A layered copy-on-write scheme (base
+  * snapshot + per-query overrides) would move cost from the per-query copy, a few KB of
+  * trivial fields plus a handful of strings, onto every read, and would add either a branch
+  * per access or shared-ownership traffic between threads of one query. If Context
+  * construction shows in profiles, the copies to cut first are the full Context clones made
+  * per subquery and per stream, not this struct.
   */
 struct Settings : public BaseSettings<SettingsTraits>
 {
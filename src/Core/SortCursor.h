@@ -148,6 +148,15 @@ struct SortCursorHelper
 };
 
 
+/** NOTE: Encoding the sort columns into one memcmp-comparable byte string per row
+  * (order-preserving transforms for ints/floats, escaped variable-length strings) was
+  * considered to replace the per-column compareAt loop below. The economics are wrong for
+  * merging: a k-way heap compares each row only O(log k) times and the loop almost always
+  * decides on the first column, while normalized keys pay for materializing every key column
+  * of every row up front — strings inflate by the escaping, Nullable and collation need their
+  * own encodings, and the concatenated keys occupy extra memory per in-flight block. A win
+  * would need comparisons per row to outnumber key bytes per row, which merges do not do.
+  */
 struct SortCursor : SortCursorHelper<SortCursor>
 {
     using SortCursorHelper<SortCursor>::SortCursorHelper;
@@ -71,6 +71,13 @@ void NativeBlockInputStream::resetParser()
     is_killed.store(false);
 }
 
+/// NOTE The serialization virtuals here are per column substream, not per value, and the bulk
+/// implementations already avoid re-materialization: fixed-width types read through
+/// ReadBuffer::readBig straight into the column's PODArray (CompressedReadBuffer even decompresses
+/// directly into it when the block fits), and DataTypeString reconstructs offsets with an unrolled
+/// SIMD copy (deserializeBinarySSE2). Aliasing the read buffer's memory instead of copying does
+/// not work out: the column must own its chars past the next buffer refill, and PaddedPODArray
+/// requires its own padded allocation anyway.
 void NativeBlockInputStream::readData(const IDataType & type, IColumn & column, ReadBuffer & istr, size_t rows, double avg_value_size_hint)
 {
     IDataType::DeserializeBinaryBulkSettings settings;
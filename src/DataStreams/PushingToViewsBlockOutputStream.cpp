@@ -162,6 +162,10 @@ void PushingToViewsBlockOutputStream::write(const Block & block)
         return;
 
     // Insert data into materialized views only after successful insert into main table
+    // All views share the same input block: columns are copy-on-write, so concurrent view
+    // pipelines reading it are safe, and insert latency becomes max(views) instead of
+    // sum(views). Errors are captured per view inside process() and rethrown with the
+    // offending view's id, so one failing view does not mask the others' results.
     const Settings & settings = context.getSettingsRef();
     if (settings.parallel_view_processing && views.size() > 1)
     {
@@ -296,6 +300,15 @@ void PushingToViewsBlockOutputStream::flush()
         view.out->flush();
 }
 
+/// NOTE: For aggregating views the select below instantiates a fresh Aggregator per inserted
+/// block. Keeping a long-lived per-view aggregation context that accumulates across inserts
+/// and flushes -State rows on a timer was considered and rejected: the view insert must stay
+/// synchronous with the source insert, because the caller's success reply (and Replicated
+/// dedup of the source block) promises the view was updated — state held back in memory
+/// would be lost on crash with no replay path. The part-count problem this idea targets is
+/// addressed at the edges instead: bigger source blocks (squashing / min_insert_block_size*)
+/// amortize Aggregator setup, and the AggregatingMergeTree target merges the small -State
+/// parts in background.
 void PushingToViewsBlockOutputStream::process(const Block & block, size_t view_num)
 {
     auto & view = views[view_num];
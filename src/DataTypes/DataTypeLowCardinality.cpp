@@ -650,10 +650,27 @@ void DataTypeLowCardinality::deserializeBinaryBulkWithMultipleStreams(
 
         if (!low_cardinality_state->index_type.need_global_dictionary)
         {
-            ColumnPtr keys_column = additional_keys;
-            if (low_cardinality_state->null_map)
-                keys_column = ColumnNullable::create(additional_keys, low_cardinality_state->null_map);
-            low_cardinality_column.insertRangeFromDictionaryEncodedColumn(*keys_column, *indexes_column);
+            size_t num_special_values = dictionary_type->isNullable() ? 2 : 1;
+
+            if (column_is_empty && num_rows == indexes_column->size() && additional_keys->size() >= num_special_values)
+            {
+                /// The keys of a granule were written from a ColumnUnique, so they are distinct and
+                /// start with the special values. Install them as the dictionary directly instead of
+                /// re-hashing every key through uniqueInsertRangeFrom; the reverse index of the new
+                /// dictionary is built lazily, only if somebody inserts into the column later.
+                ColumnPtr local_dictionary = createColumnUnique(*dictionary_type, IColumn::mutate(additional_keys));
+                low_cardinality_column.setSharedDictionary(local_dictionary);
+
+                auto local_column = ColumnLowCardinality::create(local_dictionary, std::move(indexes_column));
+                low_cardinality_column.insertRangeFrom(*local_column, 0, num_rows);
+            }
+            else
+            {
+                ColumnPtr keys_column = additional_keys;
+                if (low_cardinality_state->null_map)
+                    keys_column = ColumnNullable::create(additional_keys, low_cardinality_state->null_map);
+                low_cardinality_column.insertRangeFromDictionaryEncodedColumn(*keys_column, *indexes_column);
+            }
         }
         else if (!has_additional_keys)
         {
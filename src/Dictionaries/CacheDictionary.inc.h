@@ -34,6 +34,12 @@ namespace ErrorCodes
 {
 }
 
+/// NOTE: This interface is already batched end to end: dictGet hands the whole key column
+/// down as one PaddedPODArray, probing runs as a tight loop under a single read lock, and
+/// results are written columnar. Misses are not fetched one by one either — all not-found
+/// and expired ids of the block are collected below into one UpdateUnit, which the update
+/// queue turns into a single source request. The remaining per-key virtual cost is one
+/// getItemsNumberImpl instantiation per (attribute type, call), not per row.
 template <typename AttributeType, typename OutputType, typename DefaultGetter>
 void CacheDictionary::getItemsNumberImpl(
     Attribute & attribute, const PaddedPODArray<Key> & ids, ResultArrayType<OutputType> & out, DefaultGetter && get_default) const
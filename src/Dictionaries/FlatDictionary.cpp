@@ -19,6 +19,16 @@ namespace ErrorCodes
 static const auto initial_array_size = 1024;
 static const auto max_array_size = 500000;
 
+/** NOTE: A minimal-perfect-hash layout for dense-but-offset key spaces was considered as a middle
+  * ground between this array (memory proportional to max id, hence the max_array_size cap) and
+  * 'hashed'. It does not pay off here: dictHas and dictGetOrDefault are probed with keys that may
+  * be absent, and an MPH maps an absent key to some arbitrary slot, so every entry must also store
+  * the key (or an inexact fingerprint, which would break exact lookup semantics) for verification.
+  * With keys stored per entry the footprint converges to an open-addressing table minus its load
+  * factor slack — and the 'sparse_hashed' layout already occupies that point. The MPH build cost
+  * would also recur on every reload, since the key set changes each time.
+  */
+
 
 FlatDictionary::FlatDictionary(
     const StorageID & dict_id_,
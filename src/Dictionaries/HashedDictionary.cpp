@@ -338,6 +338,17 @@ void HashedDictionary::blockToAttributes(const Block & block)
     }
 }
 
+/// NOTE: With update_field the *fetch* is already incremental (loadUpdatedAll pulls only rows
+/// changed since the last update), but the structure is still rebuilt: ExternalLoader swaps
+/// whole immutable objects (clone() + load()), so each update re-inserts saved_block into a
+/// fresh set of maps while the previous version keeps serving — peak memory is old structure
+/// + saved_block + new structure. Applying deltas into the live structure instead is not safe
+/// under this model: lookups read the HashMaps without any lock, and that is exactly what makes
+/// them fast. Making in-place updates safe would mean RCU-swapped shards with snapshot-taking
+/// readers across every attribute type, i.e. a different dictionary engine, not a patch here.
+/// An mmap-able on-disk snapshot has the same shape: the honest persistable artifact is
+/// saved_block itself, and loading from it is a caching feature with its own source-consistency
+/// story, orthogonal to this layout.
 void HashedDictionary::updateData()
 {
     if (!saved_block || saved_block->rows() == 0)
@@ -381,6 +381,13 @@ void RangeHashedDictionary::getItems(
     else throw Exception("Unexpected type of attribute: " + toString(attribute.type), ErrorCodes::LOGICAL_ERROR);
 }
 
+/// NOTE: A flattened globally-sorted range array with a sort-the-block-and-merge-walk probe
+/// was considered as a replacement for this loop. It does not fit the access pattern: lookups
+/// here are (id, date), the hash find on id dominates, and the per-id range lists are short
+/// enough that the linear scan below is effectively free. A merge walk would pay a sort and a
+/// result scatter per block to win only when one id owns a large sorted range set — which is
+/// the shape of IP-to-subnet enrichment, and that already has a dedicated structure: layout
+/// 'ip_trie' (TrieDictionary) probes a prefix trie per key with no range list at all.
 template <typename AttributeType, typename OutputType>
 void RangeHashedDictionary::getItemsImpl(
     const Attribute & attribute,
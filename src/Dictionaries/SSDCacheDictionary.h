@@ -48,6 +48,12 @@ using AttributeValueVariant = std::variant<
 /*
     Class for operations with cache file and index.
     Supports GET/SET operations.
+
+    NOTE: This is the SSD tier below the in-memory cache dictionary: values live in fixed-size
+    blocks in a local file opened with O_DIRECT, only the key -> (block, offset) index is kept
+    in memory (BucketCache), and misses fall through to the dictionary source. Configured as
+    layout 'ssd_cache' (file path, block_size, file_size, partitions); the complex-key variant
+    is in SSDComplexKeyCacheDictionary.h.
 */
 class SSDCachePartition
 {
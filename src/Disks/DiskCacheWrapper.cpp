@@ -75,8 +75,14 @@ struct FileDownloadMetadata
 };
 
 DiskCacheWrapper::DiskCacheWrapper(
-    std::shared_ptr<IDisk> delegate_, std::shared_ptr<DiskLocal> cache_disk_, std::function<bool(const String &)> cache_file_predicate_)
-    : DiskDecorator(delegate_), cache_disk(cache_disk_), cache_file_predicate(cache_file_predicate_)
+    std::shared_ptr<IDisk> delegate_,
+    std::shared_ptr<DiskLocal> cache_disk_,
+    std::function<bool(const String &)> cache_file_predicate_,
+    UInt64 max_file_size_to_cache_)
+    : DiskDecorator(delegate_)
+    , cache_disk(cache_disk_)
+    , cache_file_predicate(cache_file_predicate_)
+    , max_file_size_to_cache(max_file_size_to_cache_)
 {
 }
 
@@ -113,6 +119,11 @@ DiskCacheWrapper::readFile(const String & path, size_t buf_size, size_t estimate
     if (cache_disk->exists(path))
         return cache_disk->readFile(path, buf_size, estimated_size, aio_threshold, mmap_threshold);
 
+    /// Caching is whole-file: serving a partial read of a big file from cache would first
+    /// download all of it. Read such files from the underlying disk directly.
+    if (max_file_size_to_cache && DiskDecorator::getFileSize(path) > max_file_size_to_cache)
+        return DiskDecorator::readFile(path, buf_size, estimated_size, aio_threshold, mmap_threshold);
+
     auto metadata = acquireDownloadMetadata(path);
 
     {
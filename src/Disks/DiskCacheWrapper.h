@@ -18,6 +18,10 @@ struct FileDownloadMetadata;
  * When readFile() is invoked and file exists in cache wrapper reads this file from cache.
  * If file doesn't exist wrapper downloads this file from underlying disk to cache.
  * readFile() invocation is thread-safe.
+ *
+ * Files are cached as a whole, so a read of a few bytes from a large uncached file would
+ * download all of it first. Files bigger than max_file_size_to_cache are read from the
+ * underlying disk directly (0 disables the limit).
  */
 class DiskCacheWrapper : public DiskDecorator
 {
@@ -25,7 +29,8 @@ public:
     DiskCacheWrapper(
         std::shared_ptr<IDisk> delegate_,
         std::shared_ptr<DiskLocal> cache_disk_,
-        std::function<bool(const String &)> cache_file_predicate_);
+        std::function<bool(const String &)> cache_file_predicate_,
+        UInt64 max_file_size_to_cache_ = 0);
     void createDirectory(const String & path) override;
     void createDirectories(const String & path) override;
     void clearDirectory(const String & path) override;
@@ -50,6 +55,8 @@ private:
     std::shared_ptr<DiskLocal> cache_disk;
     /// Cache only files satisfies predicate.
     const std::function<bool(const String &)> cache_file_predicate;
+    /// Do not cache files bigger than this (0 means no limit).
+    const UInt64 max_file_size_to_cache;
     /// Contains information about currently running file downloads to cache.
     mutable std::unordered_map<String, std::weak_ptr<FileDownloadMetadata>> file_downloads;
     /// Protects concurrent downloading files to cache.
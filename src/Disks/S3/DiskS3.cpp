@@ -180,36 +180,24 @@ namespace
 
         off_t seek(off_t offset_, int whence) override
         {
+            if (whence != SEEK_SET && whence != SEEK_CUR)
+                throw Exception("Only SEEK_SET or SEEK_CUR modes are allowed.", ErrorCodes::CANNOT_SEEK_THROUGH_FILE);
+
             if (whence == SEEK_CUR)
+                offset_ += getPosition();
+
+            /// If position is within current working buffer - shift pos. The data is already
+            /// downloaded, a new ranged request would pay a round trip for nothing.
+            /// (Note that the unified check also bounds relative seeks from below: the old
+            /// SEEK_CUR branch could move pos before the beginning of the buffer.)
+            if (working_buffer.size() && size_t(offset_) >= absolute_position - working_buffer.size()
+                && size_t(offset_) < absolute_position)
             {
-                /// If position within current working buffer - shift pos.
-                if (working_buffer.size() && size_t(getPosition() + offset_) < absolute_position)
-                {
-                    pos += offset_;
-                    return getPosition();
-                }
-                else
-                {
-                    absolute_position += offset_;
-                }
-            }
-            else if (whence == SEEK_SET)
-            {
-                /// If position within current working buffer - shift pos.
-                if (working_buffer.size() && size_t(offset_) >= absolute_position - working_buffer.size()
-                    && size_t(offset_) < absolute_position)
-                {
-                    pos = working_buffer.end() - (absolute_position - offset_);
-                    return getPosition();
-                }
-                else
-                {
-                    absolute_position = offset_;
-                }
+                pos = working_buffer.end() - (absolute_position - offset_);
+                return getPosition();
             }
-            else
-                throw Exception("Only SEEK_SET or SEEK_CUR modes are allowed.", ErrorCodes::CANNOT_SEEK_THROUGH_FILE);
 
+            absolute_position = offset_;
             current_buf = initialize();
             pos = working_buffer.end();
 
@@ -166,7 +166,9 @@ void registerDiskS3(DiskFactory & factory)
                        || path.ends_with("txt") || path.ends_with("dat");
             };
 
-            return std::make_shared<DiskCacheWrapper>(s3disk, cache_disk, cache_file_predicate);
+            auto max_cache_file_size = config.getUInt64(config_prefix + ".max_cache_file_size", 1024 * 1024 * 1024);
+
+            return std::make_shared<DiskCacheWrapper>(s3disk, cache_disk, cache_file_predicate, max_cache_file_size);
         }
 
         return s3disk;
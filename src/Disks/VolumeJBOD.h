@@ -9,6 +9,17 @@ namespace DB
  * Implements something similar to JBOD (https://en.wikipedia.org/wiki/Non-RAID_drive_architectures#JBOD).
  * When MergeTree engine wants to write part — it requests VolumeJBOD to reserve space on the next available
  * disk and then writes new part to that disk.
+ *
+ * NOTE: Placement is write-time round-robin on purpose. Read-load-aware placement was
+ * considered and rejected: at reservation time the future read popularity of a part is
+ * unknown (a hot partition's heat is observed long after its parts were placed), IDisk
+ * exposes no per-disk read counters to steer by, and chasing instantaneous load would
+ * correlate placement with whatever was momentarily idle. Round-robin spreads each
+ * partition's parts across all spindles uniformly, which is also the best static layout for
+ * the whole-partition scans that saturate a single disk otherwise. Striping one part's
+ * column files across disks would break the invariant that a part is one directory on one
+ * disk — part moves between volumes, hardlink-based mutations, detach/attach and checksums
+ * all rely on it — i.e. it is a different storage format, not a placement policy.
  */
 class VolumeJBOD : public IVolume
 {
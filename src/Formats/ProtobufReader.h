@@ -33,6 +33,14 @@ using AggregateFunctionPtr = std::shared_ptr<IAggregateFunction>;
 
 
 /** Deserializes a protobuf, tries to cast data types if necessarily.
+  *
+  * The descriptor-to-column plan is resolved once, in the constructor: ProtobufColumnMatcher
+  * walks the message descriptor against the column names and each matched field gets a converter
+  * (the column writer thunk) chosen for its exact (protobuf field type, column type) pair. Per
+  * row, readColumnIndex does one lookup in field_number_to_field_map per field that occurs on the
+  * wire - there is no repeated per-row matching to compile away. Packed repeated fields still go
+  * value by value through the converter because the row format interface
+  * (IDataType::deserializeProtobuf) inserts one value at a time.
   */
 class ProtobufReader : private boost::noncopyable
 {
@@ -0,0 +1,182 @@
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <Core/Defines.h>
+#include <Common/Stopwatch.h>
+
+#include <Columns/ColumnString.h>
+#include <Columns/ColumnsNumber.h>
+#include <DataTypes/DataTypeString.h>
+#include <DataTypes/DataTypesNumber.h>
+
+#include <IO/ReadBufferFromString.h>
+#include <IO/WriteBufferFromString.h>
+
+#include <DataStreams/NativeBlockInputStream.h>
+#include <DataStreams/NativeBlockOutputStream.h>
+
+#include <Processors/Formats/Impl/CSVRowInputFormat.h>
+#include <Processors/Formats/Impl/CSVRowOutputFormat.h>
+#include <Processors/Formats/Impl/JSONEachRowRowInputFormat.h>
+#include <Processors/Formats/Impl/JSONEachRowRowOutputFormat.h>
+#include <Processors/Formats/Impl/TabSeparatedRowInputFormat.h>
+#include <Processors/Formats/Impl/TabSeparatedRowOutputFormat.h>
+#include <Processors/Formats/InputStreamFromInputFormat.h>
+#include <Processors/Formats/OutputStreamToOutputFormat.h>
+
+
+/** Measures serialize and parse throughput (rows/sec and MiB/sec) of TSV, CSV, JSONEachRow
+  * and Native on a representative (UInt64, Float64, String) schema.
+  *
+  * Usage: ./format_throughput [rows]
+  *
+  * Run before and after changes to ReadHelpers or the row formats to catch parser regressions.
+  * Data is deterministic, so numbers are comparable between runs and builds.
+  */
+
+using namespace DB;
+
+static Block createBlock(size_t rows)
+{
+    auto col_id = ColumnUInt64::create();
+    auto col_value = ColumnFloat64::create();
+    auto col_name = ColumnString::create();
+
+    for (size_t i = 0; i < rows; ++i)
+    {
+        col_id->insertValue(i * 2654435761);
+        col_value->insertValue(static_cast<Float64>(i) * 0.0001);
+        std::string name = "event_" + std::to_string(i % 100000);
+        col_name->insertData(name.data(), name.size());
+    }
+
+    Block block;
+    block.insert({std::move(col_id), std::make_shared<DataTypeUInt64>(), "id"});
+    block.insert({std::move(col_value), std::make_shared<DataTypeFloat64>(), "value"});
+    block.insert({std::move(col_name), std::make_shared<DataTypeString>(), "name"});
+    return block;
+}
+
+static void report(const std::string & format, const char * direction, size_t rows, size_t bytes, double seconds)
+{
+    std::cerr << format << " " << direction << ": "
+        << static_cast<size_t>(rows / seconds) << " rows/sec., "
+        << bytes / 1048576.0 / seconds << " MiB/sec."
+        << std::endl;
+}
+
+int main(int argc, char ** argv)
+try
+{
+    size_t rows = argc >= 2 ? std::stoull(argv[1]) : 1000000;
+
+    Block block = createBlock(rows);
+    Block header = block.cloneEmpty();
+
+    FormatSettings format_settings;
+    RowInputFormatParams params{DEFAULT_INSERT_BLOCK_SIZE, 0, 0, []{}};
+    auto write_callback = [](const Columns &, size_t){};
+
+    struct FormatEntry
+    {
+        std::string name;
+        std::function<BlockOutputStreamPtr(WriteBuffer &)> create_output;
+        std::function<BlockInputStreamPtr(ReadBuffer &)> create_input;
+    };
+
+    std::vector<FormatEntry> formats =
+    {
+        {
+            "TSV",
+            [&](WriteBuffer & out) -> BlockOutputStreamPtr
+            {
+                return std::make_shared<OutputStreamToOutputFormat>(
+                    std::make_shared<TabSeparatedRowOutputFormat>(out, header, false, false, write_callback, format_settings));
+            },
+            [&](ReadBuffer & in) -> BlockInputStreamPtr
+            {
+                return std::make_shared<InputStreamFromInputFormat>(
+                    std::make_shared<TabSeparatedRowInputFormat>(header, in, params, false, false, format_settings));
+            }
+        },
+        {
+            "CSV",
+            [&](WriteBuffer & out) -> BlockOutputStreamPtr
+            {
+                return std::make_shared<OutputStreamToOutputFormat>(
+                    std::make_shared<CSVRowOutputFormat>(out, header, false, write_callback, format_settings));
+            },
+            [&](ReadBuffer & in) -> BlockInputStreamPtr
+            {
+                return std::make_shared<InputStreamFromInputFormat>(
+                    std::make_shared<CSVRowInputFormat>(header, in, params, false, format_settings));
+            }
+        },
+        {
+            "JSONEachRow",
+            [&](WriteBuffer & out) -> BlockOutputStreamPtr
+            {
+                return std::make_shared<OutputStreamToOutputFormat>(
+                    std::make_shared<JSONEachRowRowOutputFormat>(out, header, write_callback, format_settings));
+            },
+            [&](ReadBuffer & in) -> BlockInputStreamPtr
+            {
+                return std::make_shared<InputStreamFromInputFormat>(
+                    std::make_shared<JSONEachRowRowInputFormat>(in, header, params, format_settings));
+            }
+        },
+        {
+            "Native",
+            [&](WriteBuffer & out) -> BlockOutputStreamPtr
+            {
+                return std::make_shared<NativeBlockOutputStream>(out, 0, header);
+            },
+            [&](ReadBuffer & in) -> BlockInputStreamPtr
+            {
+                return std::make_shared<NativeBlockInputStream>(in, header, 0);
+            }
+        },
+    };
+
+    for (const auto & entry : formats)
+    {
+        String data;
+
+        Stopwatch watch;
+        {
+            WriteBufferFromString out(data);
+            BlockOutputStreamPtr output = entry.create_output(out);
+            output->writePrefix();
+            output->write(block);
+            output->writeSuffix();
+        }
+        report(entry.name, "serialize", rows, data.size(), watch.elapsedSeconds());
+
+        watch.restart();
+        size_t rows_read = 0;
+        {
+            ReadBufferFromString in(data);
+            BlockInputStreamPtr input = entry.create_input(in);
+            input->readPrefix();
+            while (Block read_block = input->read())
+                rows_read += read_block.rows();
+            input->readSuffix();
+        }
+        report(entry.name, "parse", rows_read, data.size(), watch.elapsedSeconds());
+
+        if (rows_read != rows)
+        {
+            std::cerr << entry.name << ": parsed " << rows_read << " rows instead of " << rows << std::endl;
+            return 1;
+        }
+    }
+
+    return 0;
+}
+catch (...)
+{
+    std::cerr << getCurrentExceptionMessage(true) << '\n';
+    return 1;
+}
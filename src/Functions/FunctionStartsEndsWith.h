@@ -3,7 +3,7 @@
 #include <Functions/GatherUtils/Sources.h>
 #include <Functions/IFunctionImpl.h>
 #include <Functions/PerformanceAdaptors.h>
-#include <Functions/TargetSpecific.h>
+#include <Common/TargetSpecific.h>
 #include <DataTypes/DataTypeString.h>
 #include <DataTypes/DataTypesNumber.h>
 #include <Columns/ColumnString.h>
@@ -60,6 +60,12 @@ public:
       * Otherwise, convert all low cardinality columns to ordinary columns.
       * Returns ColumnLowCardinality if at least one argument is ColumnLowCardinality.
       */
+    /** This is the dictionary fast path: the function runs over the unique values only and the
+      * index column is reused untouched, so e.g. LIKE over a LowCardinality(String) column does
+      * one match per distinct value per block (and per distinct dictionary when the result cache
+      * applies, see ExecutableFunctionLowCardinalityResultCache). Functions should only opt out
+      * when their result for a row depends on more than that row's value.
+      */
     virtual bool useDefaultImplementationForLowCardinalityColumns() const { return true; }
 
     /** Some arguments could remain constant during this implementation.
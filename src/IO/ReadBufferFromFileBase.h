@@ -20,6 +20,10 @@ public:
     ~ReadBufferFromFileBase() override;
     virtual std::string getFileName() const = 0;
 
+    /// Hint the OS that the specified range of the file will be read soon. It is just a hint:
+    /// implementations may do nothing, and a subsequent read will succeed regardless.
+    virtual void prefetch(size_t /* offset */, size_t /* length */) {}
+
     /// It is possible to get information about the time of each reading.
     struct ProfileInfo
     {
@@ -53,7 +53,10 @@ bool ReadBufferFromFileDescriptor::nextImpl()
         ssize_t res = 0;
         {
             CurrentMetrics::Increment metric_increment{CurrentMetrics::Read};
-            res = ::read(fd, internal_buffer.begin(), internal_buffer.size());
+            if (use_pread)
+                res = ::pread(fd, internal_buffer.begin(), internal_buffer.size(), file_offset_of_buffer_end);
+            else
+                res = ::read(fd, internal_buffer.begin(), internal_buffer.size());
         }
         if (!res)
             break;
@@ -135,10 +138,18 @@ off_t ReadBufferFromFileDescriptor::seek(off_t offset, int whence)
     }
     else
     {
+        pos = working_buffer.end();
+
+        /// With pread the next read takes the offset with it, no need to move the fd position.
+        if (use_pread)
+        {
+            file_offset_of_buffer_end = new_pos;
+            return new_pos;
+        }
+
         ProfileEvents::increment(ProfileEvents::Seek);
         Stopwatch watch(profile_callback ? clock_type : CLOCK_MONOTONIC);
 
-        pos = working_buffer.end();
         off_t res = ::lseek(fd, new_pos, SEEK_SET);
         if (-1 == res)
             throwFromErrnoWithPath("Cannot seek through file " + getFileName(), getFileName(),
@@ -153,6 +164,18 @@ off_t ReadBufferFromFileDescriptor::seek(off_t offset, int whence)
 }
 
 
+void ReadBufferFromFileDescriptor::prefetch(size_t offset, size_t length)
+{
+#if defined(POSIX_FADV_WILLNEED)
+    /// Ignore the return code: this is only a hint and the read will succeed anyway.
+    posix_fadvise(fd, offset, length, POSIX_FADV_WILLNEED);
+#else
+    UNUSED(offset);
+    UNUSED(length);
+#endif
+}
+
+
 /// Assuming file descriptor supports 'select', check that we have data to read or wait until timeout.
 bool ReadBufferFromFileDescriptor::poll(size_t timeout_microseconds)
 {
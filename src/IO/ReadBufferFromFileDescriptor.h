@@ -15,6 +15,7 @@ class ReadBufferFromFileDescriptor : public ReadBufferFromFileBase
 protected:
     int fd;
     size_t file_offset_of_buffer_end; /// What offset in file corresponds to working_buffer.end().
+    bool use_pread = false; /// Read with pread at an explicit offset instead of read + lseek.
 
     bool nextImpl() override;
 
@@ -38,9 +39,28 @@ public:
     /// If 'offset' is small enough to stay in buffer after seek, then true seek in file does not happen.
     off_t seek(off_t off, int whence) override;
 
+    /// Ask the OS to read ahead the specified range of the file into the page cache.
+    void prefetch(size_t offset, size_t length) override;
+
 private:
     /// Assuming file descriptor supports 'select', check that we have data to read or wait until timeout.
     bool poll(size_t timeout_microseconds);
 };
 
+
+/** Reads with pread at the offset it tracks itself, so seeking costs no syscall at all.
+  * Preferable for files that are read in many small pieces at different offsets (column streams),
+  * where read + lseek pays two syscalls where one suffices. Does not change the fd position,
+  * hence must not be mixed with other readers of the same descriptor that rely on it.
+  */
+class ReadBufferFromFileDescriptorPRead : public ReadBufferFromFileDescriptor
+{
+public:
+    ReadBufferFromFileDescriptorPRead(int fd_, size_t buf_size = DBMS_DEFAULT_BUFFER_SIZE, char * existing_memory = nullptr, size_t alignment = 0)
+        : ReadBufferFromFileDescriptor(fd_, buf_size, existing_memory, alignment)
+    {
+        use_pread = true;
+    }
+};
+
 }
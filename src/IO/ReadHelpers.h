@@ -13,6 +13,7 @@
 #include <common/LocalDateTime.h>
 #include <common/StringRef.h>
 #include <common/arithmeticOverflow.h>
+#include <common/find_symbols.h>
 
 #include <Core/Types.h>
 #include <Core/DecimalFunctions.h>
@@ -1016,8 +1017,15 @@ void readText(std::vector<T> & x, ReadBuffer & buf)
 /// Skip whitespace characters.
 inline void skipWhitespaceIfAny(ReadBuffer & buf)
 {
-    while (!buf.eof() && isWhitespaceASCII(*buf.position()))
-        ++buf.position();
+    /// Scan 16 bytes at a time: for formats with whitespace between values (JSONEachRow,
+    /// pretty-printed JSON, Values) this is hot and a per-byte loop wastes most of it.
+    /// The symbol set must match isWhitespaceASCII.
+    while (!buf.eof())
+    {
+        buf.position() = find_first_not_symbols<' ', '\t', '\n', '\r', '\f', '\v'>(buf.position(), buf.buffer().end());
+        if (buf.hasPendingData())
+            return;
+    }
 }
 
 /// Skips json value.
@@ -42,8 +42,10 @@ private:
     using Base = LRUCache<UInt128, UncompressedCacheCell, UInt128TrivialHash, UncompressedSizeWeightFunction>;
 
 public:
+    /// Half of the cache is reserved for blocks accessed more than once, so a single
+    /// large scan cannot evict the hot set of point queries (see LRUCache).
     UncompressedCache(size_t max_size_in_bytes)
-        : Base(max_size_in_bytes) {}
+        : Base(max_size_in_bytes, 0.5) {}
 
     /// Calculate key from path to file and offset.
     static UInt128 hash(const String & path_to_file, size_t offset)
@@ -539,6 +539,14 @@ void ActionsMatcher::visit(const ASTIdentifier & identifier, const ASTPtr & ast,
 void ActionsMatcher::visit(const ASTFunction & node, const ASTPtr & ast, Data & data)
 {
     CachedColumnName column_name;
+    /// This early return is the common-subexpression elimination for the actions DAG:
+    /// an expression's column is named after its canonical text (getColumnName), so a
+    /// structurally identical subtree that was already turned into an action finds its
+    /// result column in the block and adds nothing — toDate(ts) appearing five times is
+    /// computed once per block. QueryNormalizer has substituted aliases before this point,
+    /// so aliased duplicates fold too. Only syntactically different but semantically equal
+    /// forms (e.g. commuted arguments) are computed separately. Constant subtrees are folded
+    /// when actions execute on the sample block (isSuitableForConstantFolding).
     if (data.hasColumn(column_name.get(ast)))
         return;
 
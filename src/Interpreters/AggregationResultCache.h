@@ -0,0 +1,74 @@
+#pragma once
+
+#include <memory>
+
+#include <Common/LRUCache.h>
+#include <Common/ProfileEvents.h>
+#include <Common/SipHash.h>
+#include <Core/Block.h>
+
+
+namespace ProfileEvents
+{
+    extern const Event AggregationResultCacheHits;
+    extern const Event AggregationResultCacheMisses;
+}
+
+namespace DB
+{
+
+/// Finalized result of an aggregation query. The header is stored separately
+/// because the result may consist of zero blocks.
+struct AggregationResult
+{
+    Block header;
+    Blocks blocks;
+};
+
+struct AggregationResultWeightFunction
+{
+    size_t operator()(const AggregationResult & result) const
+    {
+        size_t res = 0;
+        for (const auto & block : result.blocks)
+            res += block.allocatedBytes();
+        return res;
+    }
+};
+
+
+/** Cache of finalized results of aggregation queries over MergeTree tables.
+  * The fingerprint of the set of data parts the query reads is mixed into the key,
+  * so after any insert, merge or mutation the old entries simply become unreachable
+  * and are evicted by LRU; no explicit invalidation is needed.
+  */
+class AggregationResultCache : public LRUCache<UInt128, AggregationResult, UInt128TrivialHash, AggregationResultWeightFunction>
+{
+private:
+    using Base = LRUCache<UInt128, AggregationResult, UInt128TrivialHash, AggregationResultWeightFunction>;
+
+public:
+    AggregationResultCache(size_t max_size_in_bytes)
+        : Base(max_size_in_bytes), max_entry_size(max_size_in_bytes / 2) {}
+
+    MappedPtr get(const Key & key)
+    {
+        auto result = Base::get(key);
+        if (result)
+            ProfileEvents::increment(ProfileEvents::AggregationResultCacheHits);
+        else
+            ProfileEvents::increment(ProfileEvents::AggregationResultCacheMisses);
+
+        return result;
+    }
+
+    /// Results larger than this are not worth caching: they would evict too many other entries.
+    size_t maxEntrySize() const { return max_entry_size; }
+
+private:
+    const size_t max_entry_size;
+};
+
+using AggregationResultCachePtr = std::shared_ptr<AggregationResultCache>;
+
+}
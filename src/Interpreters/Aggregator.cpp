@@ -388,7 +388,8 @@ AggregatedDataVariants::Type Aggregator::chooseAggregationMethod()
             return AggregatedDataVariants::Type::keys256;
     }
 
-    /// If single string key - will use hash table with references to it. Strings itself are stored separately in Arena.
+    /// If single string key - will use StringHashMap, which stores keys of up to 24 bytes
+    /// inline in the slot with length-dispatched hashing. Only longer keys are stored in Arena.
     if (params.keys_size == 1 && isString(types_removed_nullable[0]))
     {
         if (has_low_cardinality)
@@ -512,6 +513,19 @@ void NO_INLINE Aggregator::executeImplCase(
 }
 
 
+/// Aggregation methods whose state exposes the plain array of keys and whose hash table
+/// can prefetch cells by hash: for them, target buckets can be prefetched several rows
+/// ahead of insertion to hide the dependent hash -> load chain latency.
+template <typename State, typename Data, typename = void>
+struct CanPrefetchAggregationKeys : std::false_type {};
+
+template <typename State, typename Data>
+struct CanPrefetchAggregationKeys<State, Data, std::void_t<
+    decltype(std::declval<const Data &>().prefetch(
+        std::declval<const Data &>().hash(std::declval<const State &>().getKeyData()[0])))>>
+    : std::true_type {};
+
+
 template <typename Method>
 void NO_INLINE Aggregator::executeImplBatch(
     Method & method,
@@ -530,8 +544,9 @@ void NO_INLINE Aggregator::executeImplBatch(
         return;
     }
 
-    /// Optimization for special case when aggregating by 8bit key.
-    if constexpr (std::is_same_v<Method, typename decltype(AggregatedDataVariants::key8)::element_type>)
+    /// Optimization for special case when aggregating by 8bit or 16bit key.
+    if constexpr (std::is_same_v<Method, typename decltype(AggregatedDataVariants::key8)::element_type>
+        || std::is_same_v<Method, typename decltype(AggregatedDataVariants::key16)::element_type>)
     {
         /// We use another method if there are aggregate functions with -Array combinator.
         bool has_arrays = false;
@@ -548,18 +563,30 @@ void NO_INLINE Aggregator::executeImplBatch(
         {
             for (AggregateFunctionInstruction * inst = aggregate_instructions; inst->that; ++inst)
             {
-                inst->batch_that->addBatchLookupTable8(
-                    rows,
-                    reinterpret_cast<AggregateDataPtr *>(method.data.data()),
-                    inst->state_offset,
-                    [&](AggregateDataPtr & aggregate_data)
-                    {
-                        aggregate_data = aggregates_pool->alignedAlloc(total_size_of_aggregate_states, align_aggregate_states);
-                        createAggregateStates(aggregate_data);
-                    },
-                    state.getKeyData(),
-                    inst->batch_arguments,
-                    aggregates_pool);
+                auto init = [&](AggregateDataPtr & aggregate_data)
+                {
+                    aggregate_data = aggregates_pool->alignedAlloc(total_size_of_aggregate_states, align_aggregate_states);
+                    createAggregateStates(aggregate_data);
+                };
+
+                if constexpr (std::is_same_v<Method, typename decltype(AggregatedDataVariants::key8)::element_type>)
+                    inst->batch_that->addBatchLookupTable8(
+                        rows,
+                        reinterpret_cast<AggregateDataPtr *>(method.data.data()),
+                        inst->state_offset,
+                        init,
+                        state.getKeyData(),
+                        inst->batch_arguments,
+                        aggregates_pool);
+                else
+                    inst->batch_that->addBatchLookupTable16(
+                        rows,
+                        reinterpret_cast<AggregateDataPtr *>(method.data.data()),
+                        inst->state_offset,
+                        init,
+                        state.getKeyData(),
+                        inst->batch_arguments,
+                        aggregates_pool);
             }
             return;
         }
@@ -569,9 +596,20 @@ void NO_INLINE Aggregator::executeImplBatch(
 
     PODArray<AggregateDataPtr> places(rows);
 
+    /// For low cardinality methods the state exposes dictionary keys, not row keys, so they are excluded.
+    constexpr bool can_prefetch = !Method::low_cardinality_optimization
+        && CanPrefetchAggregationKeys<typename Method::State, std::decay_t<decltype(method.data)>>::value;
+    constexpr size_t prefetch_look_ahead = 16;
+
     /// For all rows.
     for (size_t i = 0; i < rows; ++i)
     {
+        if constexpr (can_prefetch)
+        {
+            if (i + prefetch_look_ahead < rows)
+                method.data.prefetch(method.data.hash(state.getKeyData()[i + prefetch_look_ahead]));
+        }
+
         AggregateDataPtr aggregate_data = nullptr;
 
         auto emplace_result = state.emplaceKey(method.data, i, *aggregates_pool);
@@ -781,9 +819,13 @@ bool Aggregator::executeOnBlock(Columns columns, UInt64 num_rows, AggregatedData
 
     size_t result_size = result.sizeWithoutOverflowRow();
     Int64 current_memory_usage = 0;
+    Int64 memory_tracker_limit = 0;
     if (auto * memory_tracker_child = CurrentThread::getMemoryTracker())
         if (auto * memory_tracker = memory_tracker_child->getParent())
+        {
             current_memory_usage = memory_tracker->get();
+            memory_tracker_limit = memory_tracker->getHardLimit();
+        }
 
     /// Here all the results in the sum are taken into account, from different threads.
     auto result_size_bytes = current_memory_usage - memory_usage_before_aggregation;
@@ -805,9 +847,13 @@ bool Aggregator::executeOnBlock(Columns columns, UInt64 num_rows, AggregatedData
     /** Flush data to disk if too much RAM is consumed.
       * Data can only be flushed to disk if a two-level aggregation structure is used.
       */
-    if (params.max_bytes_before_external_group_by
+    size_t max_bytes_before_external_group_by = params.max_bytes_before_external_group_by;
+    if (!max_bytes_before_external_group_by && params.max_bytes_ratio_before_external_group_by > 0. && memory_tracker_limit > 0)
+        max_bytes_before_external_group_by = static_cast<size_t>(memory_tracker_limit * params.max_bytes_ratio_before_external_group_by);
+
+    if (max_bytes_before_external_group_by
         && result.isTwoLevel()
-        && current_memory_usage > static_cast<Int64>(params.max_bytes_before_external_group_by)
+        && current_memory_usage > static_cast<Int64>(max_bytes_before_external_group_by)
         && worth_convert_to_two_level)
     {
         size_t size = current_memory_usage + params.min_free_disk_space;
@@ -2006,6 +2052,12 @@ ManyAggregatedDataVariants Aggregator::prepareVariantsToMerge(ManyAggregatedData
         }
     }
 
+    /// Converting even small single-level states lets the merge fan out over buckets
+    /// and stream finalized buckets downstream instead of merging on one thread.
+    if (params.two_level_merge && !has_at_least_one_two_level
+        && non_empty_data.size() > 1 && non_empty_data[0]->isConvertibleToTwoLevel())
+        has_at_least_one_two_level = true;
+
     if (has_at_least_one_two_level)
         for (auto & variant : non_empty_data)
             if (!variant->isTwoLevel())
@@ -873,6 +873,13 @@ public:
 
         /// Settings to flush temporary data to the filesystem (external aggregation).
         const size_t max_bytes_before_external_group_by;        /// 0 - do not use external aggregation.
+        /// Start external aggregation when query memory usage exceeds this share of the
+        /// query memory limit. Used when max_bytes_before_external_group_by is not set.
+        double max_bytes_ratio_before_external_group_by = 0.;
+
+        /// Convert single-level aggregation states to two-level before the final merge,
+        /// so that the merge can run in parallel over buckets even for small tables.
+        bool two_level_merge = false;
 
         /// Return empty result when aggregating without keys on empty set.
         bool empty_result_for_aggregation_by_empty_set;
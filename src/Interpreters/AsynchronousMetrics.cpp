@@ -13,6 +13,7 @@
 #include <IO/UncompressedCache.h>
 #include <Databases/IDatabase.h>
 #include <chrono>
+#include <unistd.h>
 
 
 #if !defined(ARCADIA_BUILD)
@@ -367,6 +368,43 @@ void AsynchronousMetrics::update()
     {
         tryLogCurrentException(__PRETTY_FUNCTION__);
     }
+
+    // Per-NUMA-node memory occupancy, to see remote/local placement of our allocations
+    // on multi-socket machines. Ignoring errors: the sysfs node directory does not exist
+    // on single-node kernels.
+    try
+    {
+        for (size_t node = 0;; ++node)
+        {
+            std::string path = fmt::format("/sys/devices/system/node/node{}/meminfo", node);
+            if (0 != access(path.c_str(), R_OK))
+                break;
+
+            ReadBufferFromFile buf(path, 4096 /* buf_size */);
+
+            // Lines look like "Node 0 MemFree:    12345678 kB".
+            while (!buf.eof())
+            {
+                std::string s;
+                readEscapedStringUntilEOL(s, buf);
+                ++buf.position();
+
+                for (const char * name : {"MemTotal", "MemFree", "MemUsed"})
+                {
+                    if (s.find(name) == std::string::npos)
+                        continue;
+
+                    if (auto colon = s.find_first_of(':'); colon != std::string::npos)
+                        new_values[fmt::format("NUMANode{}_{}", name, node)] = std::stoull(s.substr(colon + 1)) * 1024;
+                    break;
+                }
+            }
+        }
+    }
+    catch (...)
+    {
+        tryLogCurrentException(__PRETTY_FUNCTION__);
+    }
 #endif
 
     /// Add more metrics as you wish.
@@ -54,6 +54,14 @@ public:
 #endif
 
     /// When query_kind == INITIAL_QUERY, these values are equal to current.
+    /// NOTE: This is the cross-shard trace context. Connection::sendQuery forwards ClientInfo
+    /// as-is for SECONDARY_QUERY, so every shard's query_log/query_thread_log row carries the
+    /// initiator's initial_query_id, and each shard also records its own timings and
+    /// ProfileEvents (including the wait-attribution events) there. A per-shard waterfall is
+    /// therefore a query over the shards' query_log filtered by initial_query_id (e.g. via a
+    /// Distributed table over system.query_log), not new wire protocol: piggybacking phase
+    /// timings on the ProfileInfo packet would duplicate what the logs already persist and
+    /// would be lost exactly in the failure cases where the trace matters most.
     String initial_user;
     String initial_query_id;
     Poco::Net::SocketAddress initial_address;
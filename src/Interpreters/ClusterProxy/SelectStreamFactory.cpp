@@ -99,7 +99,11 @@ auto createLocalPipe(
      */
     /// return std::make_shared<MaterializingBlockInputStream>(stream);
 
-    pipeline.setMaxThreads(1);
+    /** The local shard runs in the same process: aggregate function states are handed between
+      * the pipelines as ColumnAggregateFunction pointers, without the Native serialization
+      * roundtrip that the remote path pays. Do not limit the pipeline to a single thread,
+      * so that the first stage of aggregation can run at full parallelism as well.
+      */
     return QueryPipeline::getPipe(std::move(pipeline));
 }
 
@@ -18,6 +18,8 @@
 #include <Databases/IDatabase.h>
 #include <Storages/IStorage.h>
 #include <Storages/MarkCache.h>
+#include <Interpreters/AggregationResultCache.h>
+#include <Interpreters/JoinCache.h>
 #include <Storages/MergeTree/BackgroundProcessingPool.h>
 #include <Storages/MergeTree/MergeList.h>
 #include <Storages/MergeTree/MergeTreeSettings.h>
@@ -332,6 +334,8 @@ struct ContextShared
     AccessControlManager access_control_manager;
     mutable UncompressedCachePtr uncompressed_cache;        /// The cache of decompressed blocks.
     mutable MarkCachePtr mark_cache;                        /// Cache of marks in compressed files.
+    mutable AggregationResultCachePtr aggregation_result_cache; /// Cache of results of aggregation queries.
+    mutable JoinCachePtr join_cache;                        /// Cache of built join tables.
     ProcessList process_list;                               /// Executing queries at the moment.
     MergeList merge_list;                                   /// The list of executable merge (for (Replicated)?MergeTree)
     ConfigurationPtr users_config;                          /// Config with the users, profiles and quotas sections.
@@ -365,7 +369,7 @@ struct ContextShared
 
     /// Clusters for distributed tables
     /// Initialized on demand (on distributed storages initialization) since Settings should be initialized
-    std::unique_ptr<Clusters> clusters;
+    std::shared_ptr<Clusters> clusters;
     ConfigurationPtr clusters_config;                        /// Stores updated configs
     mutable std::mutex clusters_mutex;                        /// Guards clusters and clusters_config
 
@@ -1334,6 +1338,42 @@ void Context::dropMarkCache() const
 }
 
 
+void Context::setAggregationResultCache(size_t cache_size_in_bytes)
+{
+    auto lock = getLock();
+
+    if (shared->aggregation_result_cache)
+        throw Exception("Aggregation result cache has been already created.", ErrorCodes::LOGICAL_ERROR);
+
+    shared->aggregation_result_cache = std::make_shared<AggregationResultCache>(cache_size_in_bytes);
+}
+
+
+AggregationResultCachePtr Context::getAggregationResultCache() const
+{
+    auto lock = getLock();
+    return shared->aggregation_result_cache;
+}
+
+
+void Context::setJoinCache(size_t cache_size_in_bytes)
+{
+    auto lock = getLock();
+
+    if (shared->join_cache)
+        throw Exception("Join cache has been already created.", ErrorCodes::LOGICAL_ERROR);
+
+    shared->join_cache = std::make_shared<JoinCache>(cache_size_in_bytes);
+}
+
+
+JoinCachePtr Context::getJoinCache() const
+{
+    auto lock = getLock();
+    return shared->join_cache;
+}
+
+
 void Context::dropCaches() const
 {
     auto lock = getLock();
@@ -1343,6 +1383,12 @@ void Context::dropCaches() const
 
     if (shared->mark_cache)
         shared->mark_cache->reset();
+
+    if (shared->aggregation_result_cache)
+        shared->aggregation_result_cache->reset();
+
+    if (shared->join_cache)
+        shared->join_cache->reset();
 }
 
 BackgroundProcessingPool & Context::getBackgroundPool()
@@ -1545,7 +1591,7 @@ std::optional<UInt16> Context::getTCPPortSecure() const
 
 std::shared_ptr<Cluster> Context::getCluster(const std::string & cluster_name) const
 {
-    auto res = getClusters().getCluster(cluster_name);
+    auto res = getClusters()->getCluster(cluster_name);
 
     if (!res)
         throw Exception("Requested cluster '" + cluster_name + "' not found", ErrorCodes::BAD_GET);
@@ -1556,7 +1602,7 @@ std::shared_ptr<Cluster> Context::getCluster(const std::string & cluster_name) c
 
 std::shared_ptr<Cluster> Context::tryGetCluster(const std::string & cluster_name) const
 {
-    return getClusters().getCluster(cluster_name);
+    return getClusters()->getCluster(cluster_name);
 }
 
 
@@ -1571,7 +1617,7 @@ void Context::reloadClusterConfig()
         }
 
         const auto & config = cluster_config ? *cluster_config : getConfigRef();
-        auto new_clusters = std::make_unique<Clusters>(config, settings);
+        auto new_clusters = std::make_shared<Clusters>(config, settings);
 
         {
             std::lock_guard lock(shared->clusters_mutex);
@@ -1587,16 +1633,19 @@ void Context::reloadClusterConfig()
 }
 
 
-Clusters & Context::getClusters() const
+std::shared_ptr<Clusters> Context::getClusters() const
 {
+    /// Returning a snapshot keeps the critical section down to a pointer copy and makes readers
+    /// immune to a concurrent reloadClusterConfig() replacing the object (the returned reference
+    /// used to dangle in that case).
     std::lock_guard lock(shared->clusters_mutex);
     if (!shared->clusters)
     {
         const auto & config = shared->clusters_config ? *shared->clusters_config : getConfigRef();
-        shared->clusters = std::make_unique<Clusters>(config, settings);
+        shared->clusters = std::make_shared<Clusters>(config, settings);
     }
 
-    return *shared->clusters;
+    return shared->clusters;
 }
 
 
@@ -1608,7 +1657,7 @@ void Context::setClustersConfig(const ConfigurationPtr & config, const String &
     shared->clusters_config = config;
 
     if (!shared->clusters)
-        shared->clusters = std::make_unique<Clusters>(*shared->clusters_config, settings, config_name);
+        shared->clusters = std::make_shared<Clusters>(*shared->clusters_config, settings, config_name);
     else
         shared->clusters->updateClusters(*shared->clusters_config, settings, config_name);
 }
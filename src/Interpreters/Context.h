@@ -68,6 +68,8 @@ class MergeList;
 class Cluster;
 class Compiler;
 class MarkCache;
+class AggregationResultCache;
+class JoinCache;
 class UncompressedCache;
 class ProcessList;
 class QueryStatus;
@@ -491,6 +493,14 @@ public:
     std::shared_ptr<MarkCache> getMarkCache() const;
     void dropMarkCache() const;
 
+    /// Create a cache of results of aggregation queries of specified size. This can be done only once.
+    void setAggregationResultCache(size_t cache_size_in_bytes);
+    std::shared_ptr<AggregationResultCache> getAggregationResultCache() const;
+
+    /// Create a cache of built join tables of specified size. This can be done only once.
+    void setJoinCache(size_t cache_size_in_bytes);
+    std::shared_ptr<JoinCache> getJoinCache() const;
+
     /** Clear the caches of the uncompressed blocks and marks.
       * This is usually done when renaming tables, changing the type of columns, deleting a table.
       *  - since caches are linked to file names, and become incorrect.
@@ -508,7 +518,7 @@ public:
     void setDDLWorker(std::unique_ptr<DDLWorker> ddl_worker);
     DDLWorker & getDDLWorker() const;
 
-    Clusters & getClusters() const;
+    std::shared_ptr<Clusters> getClusters() const;
     std::shared_ptr<Cluster> getCluster(const std::string & cluster_name) const;
     std::shared_ptr<Cluster> tryGetCluster(const std::string & cluster_name) const;
     void setClustersConfig(const ConfigurationPtr & config, const String & config_name = "remote_servers");
@@ -0,0 +1,76 @@
+#include <Functions/likePatternToRegexp.h>
+#include <Interpreters/ConvertFunctionOrLikeVisitor.h>
+#include <Parsers/ASTLiteral.h>
+#include <unordered_map>
+
+namespace DB
+{
+
+void ConvertFunctionOrLikeData::visit(ASTFunction & function, ASTPtr &)
+{
+    if (function.name != "or" || !function.arguments)
+        return;
+
+    /// Count LIKE/ILIKE disjuncts per haystack expression first: rewriting a single LIKE
+    /// would only lose the specialized kernel (and possibly index analysis) for nothing.
+    std::unordered_map<String, size_t> patterns_per_haystack;
+
+    auto get_pattern = [](const ASTFunction & fn) -> const ASTLiteral *
+    {
+        if (fn.name != "like" && fn.name != "ilike")
+            return nullptr;
+
+        const auto & arguments = fn.arguments->children;
+        if (arguments.size() != 2)
+            return nullptr;
+
+        const auto * literal = arguments[1]->as<ASTLiteral>();
+        if (!literal || literal->value.getType() != Field::Types::String)
+            return nullptr;
+
+        return literal;
+    };
+
+    for (const auto & child : function.arguments->children)
+        if (const auto * child_fn = child->as<ASTFunction>())
+            if (get_pattern(*child_fn))
+                ++patterns_per_haystack[child_fn->arguments->children[0]->getColumnName()];
+
+    /// Haystack expression -> literal array of regexps inside its multiMatchAny.
+    std::unordered_map<String, std::shared_ptr<ASTLiteral>> haystack_to_regexps;
+    ASTs unique_elems;
+
+    for (auto & child : function.arguments->children)
+    {
+        const auto * child_fn = child->as<ASTFunction>();
+        const auto * pattern = child_fn ? get_pattern(*child_fn) : nullptr;
+
+        if (!pattern || patterns_per_haystack[child_fn->arguments->children[0]->getColumnName()] < 2)
+        {
+            unique_elems.push_back(child);
+            continue;
+        }
+
+        String regexp = likePatternToRegexp(pattern->value.get<String>());
+        /// Case insensitive. Works with UTF-8 as well.
+        if (child_fn->name == "ilike")
+            regexp = "(?i)" + regexp;
+
+        auto haystack = child_fn->arguments->children[0];
+        auto [it, inserted] = haystack_to_regexps.emplace(haystack->getColumnName(), nullptr);
+        if (inserted)
+        {
+            it->second = std::make_shared<ASTLiteral>(Field{Array{}});
+            unique_elems.push_back(makeASTFunction("multiMatchAny", haystack, it->second));
+        }
+        it->second->value.get<Array>().push_back(std::move(regexp));
+    }
+
+    /// "or" requires at least two arguments; pad with a neutral element if everything was merged.
+    if (unique_elems.size() == 1)
+        unique_elems.push_back(std::make_shared<ASTLiteral>(Field(static_cast<UInt8>(0))));
+
+    function.arguments->children = std::move(unique_elems);
+}
+
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <Interpreters/InDepthNodeVisitor.h>
+#include <Parsers/ASTFunction.h>
+
+namespace DB
+{
+
+/// Replaces groups of two or more LIKE/ILIKE disjuncts over the same expression inside an OR
+/// with a single multiMatchAny over the converted regexps, so the column is scanned once for
+/// the whole pattern set instead of once per pattern.
+class ConvertFunctionOrLikeData
+{
+public:
+    using TypeToVisit = ASTFunction;
+
+    void visit(ASTFunction & function, ASTPtr & ast);
+};
+
+using ConvertFunctionOrLikeVisitor = InDepthNodeVisitor<OneTypeMatcher<ConvertFunctionOrLikeData>, true>;
+
+}
@@ -186,6 +186,7 @@ struct DDLTask
     Cluster::Address address_in_cluster;
     size_t host_shard_num;
     size_t host_replica_num;
+    bool is_circular_replicated = false;
 
     /// Stage 3.3: execute query
     ExecutionStatus execution_status;
@@ -320,11 +321,17 @@ DDLWorker::DDLWorker(const std::string & zk_root_dir, Context & context_, const
         task_max_lifetime = config->getUInt64(prefix + ".task_max_lifetime", static_cast<UInt64>(task_max_lifetime));
         cleanup_delay_period = config->getUInt64(prefix + ".cleanup_delay_period", static_cast<UInt64>(cleanup_delay_period));
         max_tasks_in_queue = std::max<UInt64>(1, config->getUInt64(prefix + ".max_tasks_in_queue", max_tasks_in_queue));
+        pool_size = std::max<UInt64>(1, config->getUInt64(prefix + ".pool_size", pool_size));
 
         if (config->has(prefix + ".profile"))
             context.setSetting("profile", config->getString(prefix + ".profile"));
     }
 
+    /// Unlimited job queue: there is one job per active lane and lanes may outnumber threads,
+    /// and scheduling must never block (it happens under lanes_mutex, which workers also take).
+    if (pool_size > 1)
+        worker_pool = std::make_unique<ThreadPool>(pool_size, pool_size, /* queue_size = */ 0);
+
     if (context.getSettingsRef().readonly)
     {
         LOG_WARNING(log, "Distributed DDL worker is run with readonly settings, it will not be able to execute DDL queries Set appropriate system_profile or distributed_ddl.profile to fix this.");
@@ -345,6 +352,8 @@ DDLWorker::~DDLWorker()
     cleanup_event->set();
     main_thread.join();
     cleanup_thread.join();
+    if (worker_pool)
+        worker_pool->wait();
 }
 
 
@@ -365,7 +374,7 @@ DDLWorker::ZooKeeperPtr DDLWorker::getAndSetZooKeeper()
 }
 
 
-bool DDLWorker::initAndCheckTask(const String & entry_name, String & out_reason, const ZooKeeperPtr & zookeeper)
+bool DDLWorker::initAndCheckTask(const String & entry_name, String & out_reason, const ZooKeeperPtr & zookeeper, DDLTaskPtr & out_task)
 {
     String node_data;
     String entry_path = queue_dir + "/" + entry_name;
@@ -434,7 +443,7 @@ bool DDLWorker::initAndCheckTask(const String & entry_name, String & out_reason,
     }
 
     if (host_in_hostlist)
-        current_task = std::move(task);
+        out_task = std::move(task);
     else
         out_reason = "There is no a local address in host list";
 
@@ -485,7 +494,7 @@ void DDLWorker::processTasks()
         if (!current_task)
         {
             String reason;
-            if (!initAndCheckTask(entry_name, reason, zookeeper))
+            if (!initAndCheckTask(entry_name, reason, zookeeper, current_task))
             {
                 LOG_DEBUG(log, "Will not execute task {}: {}", entry_name, reason);
                 last_processed_task_name = entry_name;
@@ -496,13 +505,32 @@ void DDLWorker::processTasks()
         DDLTask & task = *current_task;
 
         bool already_processed = zookeeper->exists(task.entry_path + "/finished/" + task.host_id_str);
-        if (!server_startup && !task.was_executed && already_processed)
+        if (!server_startup && !worker_pool && !task.was_executed && already_processed)
         {
             throw Exception(
                 "Server expects that DDL task " + task.entry_name + " should be processed, but it was already processed according to ZK",
                 ErrorCodes::LOGICAL_ERROR);
         }
 
+        if (worker_pool)
+        {
+            /// Hand the entry over to its execution lane. The watermark is advanced right away:
+            /// the lane retries ZooKeeper problems itself, and after a restart the startup scan
+            /// relies on the "finished" nodes anyway, so nothing is lost.
+            if (!already_processed)
+                scheduleTaskToLane(std::move(current_task));
+            else
+                LOG_DEBUG(log, "Task {} ({}) has been already processed", task.entry_name, task.entry.query);
+
+            last_processed_task_name = entry_name;
+            current_task.reset();
+
+            if (stop_flag)
+                break;
+
+            continue;
+        }
+
         if (!already_processed)
         {
             try
@@ -540,6 +568,107 @@ void DDLWorker::processTasks()
 }
 
 
+String DDLWorker::getTaskLane(const DDLTask & task) const
+{
+    /// Entries run concurrently only when they certainly belong to different databases.
+    /// RENAME is not ASTQueryWithTableAndOutput and queries without an explicit database
+    /// fall through to the common (empty) lane, which preserves the old serial order.
+    try
+    {
+        const char * begin = task.entry.query.data();
+        const char * end = begin + task.entry.query.size();
+
+        ParserQuery parser_query(end);
+        String description;
+        ASTPtr query = parseQuery(parser_query, begin, end, description, 0, context.getSettingsRef().max_parser_depth);
+
+        if (const auto * query_with_table = dynamic_cast<const ASTQueryWithTableAndOutput *>(query.get());
+            query_with_table && !query_with_table->database.empty())
+            return query_with_table->database;
+    }
+    catch (...)
+    {
+        /// Unparseable entries get a proper error status later, in processTask().
+    }
+
+    return {};
+}
+
+
+void DDLWorker::scheduleTaskToLane(DDLTaskPtr task)
+{
+    String lane = getTaskLane(*task);
+
+    std::lock_guard lock(lanes_mutex);
+    auto & lane_queue = execution_lanes[lane];
+    bool lane_was_idle = lane_queue.empty();
+    lane_queue.emplace_back(std::move(task));
+
+    /// The first entry of an idle lane brings a worker with it. The worker drains the lane
+    /// including entries appended meanwhile, so per-lane order is never violated.
+    if (lane_was_idle)
+        worker_pool->scheduleOrThrowOnError([this, lane = std::move(lane)] { runLane(lane); });
+}
+
+
+void DDLWorker::runLane(const String & lane)
+{
+    setThreadName("DDLWorkerExec");
+    attachToThreadGroup();
+
+    while (!stop_flag)
+    {
+        DDLTask * task = nullptr;
+
+        {
+            std::lock_guard lock(lanes_mutex);
+            auto & lane_queue = execution_lanes[lane];
+            if (lane_queue.empty())
+            {
+                execution_lanes.erase(lane);
+                return;
+            }
+            task = lane_queue.front().get();
+        }
+
+        while (!stop_flag)
+        {
+            try
+            {
+                processTask(*task, getAndSetZooKeeper());
+                break;
+            }
+            catch (const Coordination::Exception & e)
+            {
+                if (!Coordination::isHardwareError(e.code))
+                {
+                    LOG_ERROR(log, "Unexpected ZooKeeper error while processing task {} ({}), skipping it: {}",
+                        task->entry_name, task->entry.query, getCurrentExceptionMessage(true));
+                    break;
+                }
+
+                /// Query execution status (including failures) is committed to ZooKeeper by
+                /// processTask() itself, so only session problems get here; retry the same
+                /// entry like the serial path does.
+                tryLogCurrentException(log, "ZooKeeper session problem while processing task " + task->entry_name + ", will retry");
+                sleepForSeconds(5);
+            }
+            catch (...)
+            {
+                LOG_WARNING(log, "An error occurred while processing task {} ({}), skipping it: {}",
+                    task->entry_name, task->entry.query, getCurrentExceptionMessage(true));
+                break;
+            }
+        }
+
+        {
+            std::lock_guard lock(lanes_mutex);
+            execution_lanes[lane].pop_front();
+        }
+    }
+}
+
+
 /// Parses query and resolves cluster and host in cluster
 void DDLWorker::parseQueryAndResolveHost(DDLTask & task)
 {
@@ -596,7 +725,7 @@ void DDLWorker::parseQueryAndResolveHost(DDLTask & task)
                          * To distinguish one replica from another on the same node,
                          * every shard is placed into separate database.
                          * */
-                        is_circular_replicated = true;
+                        task.is_circular_replicated = true;
                         auto * query_with_table = dynamic_cast<ASTQueryWithTableAndOutput *>(task.query.get());
                         if (!query_with_table || query_with_table->database.empty())
                         {
@@ -673,10 +802,10 @@ bool DDLWorker::tryExecuteQuery(const String & query, const DDLTask & task, Exec
 
     try
     {
-        current_context = std::make_unique<Context>(context);
-        current_context->getClientInfo().query_kind = ClientInfo::QueryKind::SECONDARY_QUERY;
-        current_context->setCurrentQueryId(""); // generate random query_id
-        executeQuery(istr, ostr, false, *current_context, {});
+        auto query_context = std::make_unique<Context>(context);
+        query_context->getClientInfo().query_kind = ClientInfo::QueryKind::SECONDARY_QUERY;
+        query_context->setCurrentQueryId(""); // generate random query_id
+        executeQuery(istr, ostr, false, *query_context, {});
     }
     catch (...)
     {
@@ -735,7 +864,7 @@ void DDLWorker::processTask(DDLTask & task, const ZooKeeperPtr & zookeeper)
     {
         try
         {
-            is_circular_replicated = false;
+            task.is_circular_replicated = false;
             parseQueryAndResolveHost(task);
 
             ASTPtr rewritten_ast = task.query_on_cluster->getRewrittenASTWithoutOnCluster(task.address_in_cluster.default_database);
@@ -758,7 +887,7 @@ void DDLWorker::processTask(DDLTask & task, const ZooKeeperPtr & zookeeper)
                 if (storage && query_with_table->as<ASTAlterQuery>())
                     checkShardConfig(query_with_table->table, task, storage);
 
-                if (storage && taskShouldBeExecutedOnLeader(rewritten_ast, storage)  && !is_circular_replicated)
+                if (storage && taskShouldBeExecutedOnLeader(rewritten_ast, storage)  && !task.is_circular_replicated)
                     tryExecuteQueryOnLeaderReplica(task, storage, rewritten_query, task.entry_path, zookeeper);
                 else
                     tryExecuteQuery(rewritten_query, task, task.execution_status);
@@ -10,8 +10,10 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <mutex>
 #include <thread>
+#include <unordered_map>
 
 namespace zkutil
 {
@@ -52,6 +54,7 @@ public:
 
 private:
     using ZooKeeperPtr = std::shared_ptr<zkutil::ZooKeeper>;
+    using DDLTaskPtr = std::unique_ptr<DDLTask>;
 
     /// Returns cached ZooKeeper session (possibly expired).
     ZooKeeperPtr tryGetZooKeeper() const;
@@ -61,11 +64,19 @@ private:
     void processTasks();
 
     /// Reads entry and check that the host belongs to host list of the task
-    /// Returns true and sets current_task if entry parsed and the check is passed
-    bool initAndCheckTask(const String & entry_name, String & out_reason, const ZooKeeperPtr & zookeeper);
+    /// Returns true and sets out_task if entry parsed and the check is passed
+    bool initAndCheckTask(const String & entry_name, String & out_reason, const ZooKeeperPtr & zookeeper, DDLTaskPtr & out_task);
 
     void processTask(DDLTask & task, const ZooKeeperPtr & zookeeper);
 
+    /// Entries of provably independent databases may be executed concurrently (when pool_size > 1).
+    /// A lane is the database name the query refers to, or an empty string for queries that do not
+    /// name a database (or cannot be parsed); each lane executes its entries strictly in queue order,
+    /// and the empty lane keeps the old fully serial behaviour for everything else.
+    String getTaskLane(const DDLTask & task) const;
+    void scheduleTaskToLane(DDLTaskPtr task);
+    void runLane(const String & lane);
+
     /// Check that query should be executed on leader replica only
     static bool taskShouldBeExecutedOnLeader(const ASTPtr ast_ddl, StoragePtr storage);
 
@@ -101,10 +112,8 @@ private:
     void attachToThreadGroup();
 
 private:
-    bool is_circular_replicated;
     Context & context;
     Poco::Logger * log;
-    std::unique_ptr<Context> current_context;
 
     std::string host_fqdn;      /// current host domain name
     std::string host_fqdn_id;   /// host_name:port
@@ -117,9 +126,14 @@ private:
     ZooKeeperPtr current_zookeeper;
 
     /// Save state of executed task to avoid duplicate execution on ZK error
-    using DDLTaskPtr = std::unique_ptr<DDLTask>;
     DDLTaskPtr current_task;
 
+    /// Tasks of each lane, front is the one being executed; guarded by lanes_mutex.
+    /// Used only when pool_size > 1.
+    std::unordered_map<String, std::deque<DDLTaskPtr>> execution_lanes;
+    std::mutex lanes_mutex;
+    std::unique_ptr<ThreadPool> worker_pool;
+
     std::shared_ptr<Poco::Event> queue_updated_event = std::make_shared<Poco::Event>();
     std::shared_ptr<Poco::Event> cleanup_event = std::make_shared<Poco::Event>();
     std::atomic<bool> stop_flag{false};
@@ -133,6 +147,9 @@ private:
     Int64 task_max_lifetime = 7 * 24 * 60 * 60; // week (in seconds)
     /// How many tasks could be in the queue
     size_t max_tasks_in_queue = 1000;
+    /// How many DDL entries may be executed concurrently. With the default of 1 the queue
+    /// is processed strictly serially, exactly as before the lanes were introduced.
+    size_t pool_size = 1;
 
     ThreadGroupStatusPtr thread_group;
 
@@ -745,6 +745,12 @@ void ExpressionActions::finalize(const Names & output_columns)
 #if USE_EMBEDDED_COMPILER
     /// This has to be done before removing redundant actions and inserting REMOVE_COLUMNs
     /// because inlining may change dependency sets.
+    /// NOTE: This is the LLVM fusion pass for scalar function chains: compileFunctions
+    /// (ExpressionJIT.cpp) folds maximal subgraphs of isCompilable() functions into one
+    /// LLVMFunction evaluated as a single loop over the block, eliminating the intermediate
+    /// columns between fused steps; anything non-compilable stays on the interpreted path.
+    /// Off by default (compile_expressions), and a chain is only compiled after it has been
+    /// seen min_count_to_compile_expression times, so one-off queries do not pay compilation.
     if (settings.compile_expressions)
         compileFunctions(actions, output_columns, sample_block, compilation_cache, settings.min_count_to_compile_expression);
 #endif
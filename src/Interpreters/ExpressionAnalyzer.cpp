@@ -22,8 +22,11 @@
 #include <Interpreters/HashJoin.h>
 #include <Interpreters/MergeJoin.h>
 #include <Interpreters/DictionaryReader.h>
+#include <Interpreters/JoinCache.h>
 #include <Interpreters/Context.h>
 
+#include <Storages/MergeTree/MergeTreeData.h>
+
 #include <AggregateFunctions/AggregateFunctionFactory.h>
 #include <AggregateFunctions/parseAggregateFunctionParameters.h>
 
@@ -40,6 +43,7 @@
 
 #include <DataTypes/DataTypeFactory.h>
 #include <Parsers/parseQuery.h>
+#include <Parsers/queryToString.h>
 #include <Interpreters/interpretSubquery.h>
 #include <Interpreters/DatabaseAndTableWithAlias.h>
 #include <Interpreters/misc.h>
@@ -544,7 +548,12 @@ static std::shared_ptr<IJoin> makeJoin(std::shared_ptr<TableJoin> analyzed_join,
 {
     bool allow_merge_join = analyzed_join->allowMergeJoin();
 
-    /// HashJoin with Dictionary optimisation
+    /// HashJoin with Dictionary optimisation: when the right side is a StorageDictionary
+    /// joined by its key, there is no build phase at all — probing goes straight to the
+    /// dictionary through DictionaryReader (batched getColumn calls, any number of
+    /// attributes). Covers ALL INNER and ANY/ALL/SEMI/ANTI LEFT; see TableJoin::allowDictJoin
+    /// for the exact conditions (the join key must be the dictionary key itself, not an
+    /// expression over it).
     String dict_name;
     String key_name;
     if (analyzed_join->joined_storage && allowDictJoin(analyzed_join->joined_storage, context, dict_name, key_name))
@@ -558,13 +567,82 @@ static std::shared_ptr<IJoin> makeJoin(std::shared_ptr<TableJoin> analyzed_join,
         }
     }
 
-    if (analyzed_join->forceHashJoin() || (analyzed_join->preferMergeJoin() && !allow_merge_join))
-        return std::make_shared<HashJoin>(analyzed_join, sample_block);
-    else if (analyzed_join->forceMergeJoin() || (analyzed_join->preferMergeJoin() && allow_merge_join))
+    if (analyzed_join->forceMergeJoin() || (analyzed_join->preferMergeJoin() && allow_merge_join))
         return std::make_shared<MergeJoin>(analyzed_join, sample_block);
+
+    /// No point in JoinSwitcher if MergeJoin could not take over anyway: a plain HashJoin
+    /// also allows to drop right key columns from stored blocks (see initRightBlockStructure).
+    if (analyzed_join->forceHashJoin() || !allow_merge_join)
+        return std::make_shared<HashJoin>(analyzed_join, sample_block);
+
     return std::make_shared<JoinSwitcher>(analyzed_join, sample_block);
 }
 
+/// Key for the cache of built join tables (see JoinCache), if this join may be shared between queries.
+/// Sharing is only safe for join kinds that do not mutate the table while probing: RIGHT/FULL joins
+/// and ANY INNER use flagged maps (see MapGetter in joinDispatch.h) and flip per-row "used"
+/// flags inside it.
+static std::optional<UInt128> joinCacheKey(
+    const ASTTablesInSelectQueryElement & join_element,
+    const TableJoin & analyzed_join,
+    const Block & sample_block,
+    const Context & context)
+{
+    const Settings & settings = context.getSettingsRef();
+
+    if (!settings.use_join_cache)
+        return {};
+
+    if (!(isInner(analyzed_join.kind()) || isLeft(analyzed_join.kind()))
+        || analyzed_join.strictness() == ASTTableJoin::Strictness::Asof)
+        return {};
+
+    /// ANY INNER is the one Inner/Left combination dispatched to a flagged map (MapsOneFlagged):
+    /// probing calls setUsedOnce() on matched rows, so the first query spoils the table for the next one.
+    if (isInner(analyzed_join.kind()) && analyzed_join.strictness() == ASTTableJoin::Strictness::Any)
+        return {};
+
+    /// Entries are invalidated by the set of data parts, so the right side must be a MergeTree table.
+    const auto * merge_tree = dynamic_cast<const MergeTreeData *>(analyzed_join.joined_storage.get());
+    if (!merge_tree)
+        return {};
+
+    auto tree_hash = join_element.getTreeHash();
+
+    SipHash hash;
+    hash.update(tree_hash.first);
+    hash.update(tree_hash.second);
+    hash.update(context.getCurrentDatabase());
+
+    /// The same JOIN clause may require different right-side columns in different queries.
+    for (const auto & column : sample_block)
+    {
+        hash.update(column.name);
+        hash.update(column.type->getName());
+    }
+
+    /// Settings that change the contents or structure of the built table.
+    hash.update(UInt8(settings.join_use_nulls));
+    hash.update(UInt8(settings.join_any_take_last_row));
+
+    /// The right table is read under the current user's row policy; a table built from
+    /// filtered rows must not be served to a user with a different (or no) filter.
+    auto table_id = merge_tree->getStorageID();
+    if (auto filter = context.getRowPolicyCondition(table_id.database_name, table_id.table_name, RowPolicy::SELECT_FILTER))
+        hash.update(queryToString(filter));
+
+    Strings part_names;
+    for (const auto & part : merge_tree->getDataPartsVector())
+        part_names.emplace_back(part->name);
+    std::sort(part_names.begin(), part_names.end());
+    for (const auto & name : part_names)
+        hash.update(name);
+
+    UInt128 key;
+    hash.get128(key.low, key.high);
+    return key;
+}
+
 JoinPtr SelectQueryExpressionAnalyzer::makeTableJoin(const ASTTablesInSelectQueryElement & join_element)
 {
     /// Two JOINs are not supported with the same subquery, but different USINGs.
@@ -604,6 +682,22 @@ JoinPtr SelectQueryExpressionAnalyzer::makeTableJoin(const ASTTablesInSelectQuer
         subquery_for_join.setJoinActions(joined_block_actions); /// changes subquery_for_join.sample_block inside
         subquery_for_join.join = makeJoin(syntax->analyzed_join, subquery_for_join.sample_block, context);
 
+        /// Try to reuse a join table built by a previous query against the same right-hand data.
+        if (auto cache_key = joinCacheKey(join_element, *syntax->analyzed_join, subquery_for_join.sample_block, context))
+        {
+            if (JoinCachePtr join_cache = context.getJoinCache())
+            {
+                if (JoinPtr shared_join = join_cache->get(*cache_key))
+                {
+                    /// The join is already built, no subquery has to be executed.
+                    subqueries_for_sets.erase(join_subquery_id);
+                    return shared_join;
+                }
+
+                subquery_for_join.join_cache_key = cache_key;
+            }
+        }
+
         /// Do not make subquery for join over dictionary.
         if (syntax->analyzed_join->dictionary_reader)
         {
@@ -8,6 +8,7 @@
 #include <Columns/ColumnVector.h>
 #include <Columns/ColumnFixedString.h>
 #include <Columns/ColumnNullable.h>
+#include <Columns/ColumnsCommon.h>
 
 #include <DataTypes/DataTypeNullable.h>
 #include <DataTypes/DataTypeLowCardinality.h>
@@ -431,6 +432,31 @@ namespace
     };
 
 
+    /// Whether the min/max filter over build-side keys is applicable: requires a single
+    /// directly addressable integral key (floats are excluded because of NaNs).
+    template <typename KeyGetter, typename = void>
+    struct JoinKeyRangeFilterAllowed : std::false_type {};
+
+    template <typename KeyGetter>
+    struct JoinKeyRangeFilterAllowed<KeyGetter, std::enable_if_t<
+        std::is_integral_v<std::remove_cv_t<std::remove_pointer_t<decltype(std::declval<const KeyGetter &>().getKeyData())>>>>>
+        : std::true_type
+    {
+    };
+
+    /// Whether we can prefetch the hash table cell for a row of this key getter: the keys must be
+    /// directly addressable (plain numeric column) and the hash table must support prefetching.
+    template <typename KeyGetter, typename Map, typename = void>
+    struct CanPrefetchJoinKeys : std::false_type {};
+
+    template <typename KeyGetter, typename Map>
+    struct CanPrefetchJoinKeys<KeyGetter, Map, std::void_t<
+        decltype(std::declval<const Map &>().prefetch(
+            std::declval<const Map &>().hash(std::declval<const KeyGetter &>().getKeyData()[0])))>>
+        : std::true_type
+    {
+    };
+
     template <ASTTableJoin::Strictness STRICTNESS, typename KeyGetter, typename Map, bool has_null_map>
     void NO_INLINE insertFromBlockImplTypeCase(
         HashJoin & join, Map & map, size_t rows, const ColumnRawPtrs & key_columns,
@@ -446,8 +472,38 @@ namespace
 
         auto key_getter = createKeyGetter<KeyGetter, is_asof_join>(key_columns, key_sizes);
 
+        /// For direct numeric keys, hide the latency of cache misses on the hash table buffer
+        /// by prefetching the cell a bunch of rows ahead of the one being inserted.
+        [[maybe_unused]] constexpr bool can_prefetch = CanPrefetchJoinKeys<KeyGetter, Map>::value;
+        [[maybe_unused]] constexpr size_t prefetch_look_ahead = 16;
+
+        if constexpr (JoinKeyRangeFilterAllowed<KeyGetter>::value && !is_asof_join)
+        {
+            if (rows)
+            {
+                /// Remember the [min, max] over the inserted keys, so that the probe side can skip
+                /// rows that cannot match without touching the hash table. Rows with a NULL key are
+                /// not inserted into the map, but their underlying values can only widen the range.
+                const auto * key_data = key_getter.getKeyData();
+                auto min_key = key_data[0];
+                auto max_key = key_data[0];
+                for (size_t i = 1; i < rows; ++i)
+                {
+                    min_key = std::min(min_key, key_data[i]);
+                    max_key = std::max(max_key, key_data[i]);
+                }
+                join.extendBuildKeyRange(min_key, max_key);
+            }
+        }
+
         for (size_t i = 0; i < rows; ++i)
         {
+            if constexpr (can_prefetch)
+            {
+                if (i + prefetch_look_ahead < rows)
+                    map.prefetch(map.hash(key_getter.getKeyData()[i + prefetch_look_ahead]));
+            }
+
             if (has_null_map && (*null_map)[i])
                 continue;
 
@@ -466,6 +522,11 @@ namespace
         HashJoin & join, Map & map, size_t rows, const ColumnRawPtrs & key_columns,
         const Sizes & key_sizes, Block * stored_block, ConstNullMapPtr null_map, Arena & pool)
     {
+        /// Same as on the probe side: blocks of a Nullable key without actual NULLs
+        /// can be inserted through the branch-free path.
+        if (null_map && memoryIsZero(null_map->data(), null_map->size()))
+            null_map = nullptr;
+
         if (null_map)
             insertFromBlockImplTypeCase<STRICTNESS, KeyGetter, Map, true>(join, map, rows, key_columns, key_sizes, stored_block, null_map, pool);
         else
@@ -498,7 +559,9 @@ namespace
 void HashJoin::initRightBlockStructure(Block & saved_block_sample)
 {
     /// We could remove key columns for LEFT | INNER HashJoin but we should keep them for JoinSwitcher (if any).
-    bool save_key_columns = !table_join->forceHashJoin() || isRightOrFull(kind);
+    /// A switch is only possible for joins MergeJoin supports, so for the rest (e.g. semi/anti INNER,
+    /// anti LEFT, ASOF) nothing references the keys after the hash table is built.
+    bool save_key_columns = (!table_join->forceHashJoin() && table_join->allowMergeJoin()) || isRightOrFull(kind);
     if (save_key_columns)
     {
         saved_block_sample = right_table_keys.cloneEmpty();
@@ -618,6 +681,8 @@ public:
         , asof_type(join.getAsofType())
         , asof_inequality(join.getAsofInequality())
     {
+        build_key_range = join.getBuildKeyRange();
+
         size_t num_columns_to_add = block_with_columns_to_add.columns();
         if (is_asof_join)
             ++num_columns_to_add;
@@ -661,6 +726,13 @@ public:
             columns[j]->insertFrom(*block.getByPosition(right_indexes[j]).column, row_num);
     }
 
+    /// Copy a run of adjacent rows of one stored block with a single batch call per column.
+    void appendRangeFromBlock(const Block & block, size_t row_num, size_t length)
+    {
+        for (size_t j = 0; j < right_indexes.size(); ++j)
+            columns[j]->insertRangeFrom(*block.getByPosition(right_indexes[j]).column, row_num, length);
+    }
+
     void appendDefaultRow()
     {
         ++lazy_defaults_count;
@@ -685,6 +757,8 @@ public:
     size_t rows_to_add;
     std::unique_ptr<IColumn::Offsets> offsets_to_replicate;
     bool need_filter = false;
+    /// Bit-cast [min, max] over the build-side keys, if it was tracked for this join.
+    std::optional<std::pair<UInt64, UInt64>> build_key_range;
 
 private:
     TypeAndNames type_name;
@@ -710,10 +784,29 @@ void addFoundRowAll(const typename Map::mapped_type & mapped, AddedColumns & add
     if constexpr (add_missing)
         added.applyLazyDefaults();
 
-    for (auto it = mapped.begin(); it.ok(); ++it)
+    /// Rows of one key were often inserted from the same block one after another, so they form
+    /// runs of adjacent rows. Materialize a whole run with one insertRangeFrom per column
+    /// instead of a virtual insertFrom call per column per row.
+    auto it = mapped.begin();
+    while (it.ok())
     {
-        added.appendFromBlock<false>(*it->block, it->row_num);
-        ++current_offset;
+        const Block * block = it->block;
+        size_t first_row = it->row_num;
+        size_t length = 1;
+
+        ++it;
+        while (it.ok() && it->block == block && it->row_num == first_row + length)
+        {
+            ++length;
+            ++it;
+        }
+
+        if (length == 1)
+            added.appendFromBlock<false>(*block, first_row);
+        else
+            added.appendRangeFromBlock(*block, first_row, length);
+
+        current_offset += length;
     }
 };
 
@@ -765,10 +858,27 @@ NO_INLINE IColumn::Filter joinRightColumns(const Map & map, AddedColumns & added
 
     auto key_getter = createKeyGetter<KeyGetter, is_asof_join>(added_columns.key_columns, added_columns.key_sizes);
 
+    /// Same as on the build side: prefetch the cell for a row a bunch of rows ahead.
+    [[maybe_unused]] constexpr bool can_prefetch = CanPrefetchJoinKeys<KeyGetter, Map>::value;
+    [[maybe_unused]] constexpr size_t prefetch_look_ahead = 16;
+
+    /// If the [min, max] over the build-side keys is known, rows outside of it cannot match
+    /// and are handled as a guaranteed miss, without touching the hash table at all.
+    [[maybe_unused]] constexpr bool can_range_filter = JoinKeyRangeFilterAllowed<KeyGetter>::value && !is_asof_join;
+    [[maybe_unused]] bool has_build_key_range = false;
+    if constexpr (can_range_filter)
+        has_build_key_range = added_columns.build_key_range.has_value();
+
     IColumn::Offset current_offset = 0;
 
     for (size_t i = 0; i < rows; ++i)
     {
+        if constexpr (can_prefetch)
+        {
+            if (i + prefetch_look_ahead < rows)
+                map.prefetch(map.hash(key_getter.getKeyData()[i + prefetch_look_ahead]));
+        }
+
         if constexpr (has_null_map)
         {
             if ((*null_map)[i])
@@ -781,6 +891,27 @@ NO_INLINE IColumn::Filter joinRightColumns(const Map & map, AddedColumns & added
             }
         }
 
+        if constexpr (can_range_filter)
+        {
+            if (has_build_key_range)
+            {
+                using FieldType = std::remove_cv_t<std::remove_pointer_t<decltype(key_getter.getKeyData())>>;
+                FieldType key = key_getter.getKeyData()[i];
+
+                if (key < ext::bit_cast<FieldType>(added_columns.build_key_range->first)
+                    || key > ext::bit_cast<FieldType>(added_columns.build_key_range->second))
+                {
+                    if constexpr (is_anti_join && left)
+                        setUsed<need_filter>(filter, i);
+                    addNotFoundRow<add_missing, need_replication>(added_columns, current_offset);
+
+                    if constexpr (need_replication)
+                        (*added_columns.offsets_to_replicate)[i] = current_offset;
+                    continue;
+                }
+            }
+        }
+
         auto find_result = key_getter.findKey(map, i, pool);
 
         if (find_result.isFound())
@@ -858,8 +989,14 @@ NO_INLINE IColumn::Filter joinRightColumns(const Map & map, AddedColumns & added
 }
 
 template <ASTTableJoin::Kind KIND, ASTTableJoin::Strictness STRICTNESS, typename KeyGetter, typename Map>
-IColumn::Filter joinRightColumnsSwitchNullability(const Map & map, AddedColumns & added_columns, const ConstNullMapPtr & null_map)
+IColumn::Filter joinRightColumnsSwitchNullability(const Map & map, AddedColumns & added_columns, const ConstNullMapPtr & null_map_)
 {
+    /// Nullable keys always carry a null map, but rows with actual NULLs are usually rare or
+    /// absent. One vectorized scan over the map lets such blocks take the branch-free path.
+    const NullMap * null_map = null_map_;
+    if (null_map && memoryIsZero(null_map->data(), null_map->size()))
+        null_map = nullptr;
+
     if (added_columns.need_filter)
     {
         if (null_map)
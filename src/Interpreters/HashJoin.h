@@ -5,6 +5,8 @@
 #include <shared_mutex>
 #include <deque>
 
+#include <ext/bit_cast.h>
+
 #include <Parsers/ASTTablesInSelectQuery.h>
 
 #include <Interpreters/IJoin.h>
@@ -335,6 +337,23 @@ public:
         return data;
     }
 
+    /** For a single integral join key: extend the [min, max] over all inserted right-side keys.
+      * The range is kept bit-cast to UInt64, the callers on both sides know the real key type.
+      * It lets the probe side reject rows that cannot match without touching the hash table.
+      */
+    template <typename T>
+    void extendBuildKeyRange(T min_key, T max_key)
+    {
+        if (build_key_range)
+        {
+            min_key = std::min(min_key, ext::bit_cast<T>(build_key_range->first));
+            max_key = std::max(max_key, ext::bit_cast<T>(build_key_range->second));
+        }
+        build_key_range = std::make_pair(ext::bit_cast<UInt64>(min_key), ext::bit_cast<UInt64>(max_key));
+    }
+
+    const std::optional<std::pair<UInt64, UInt64>> & getBuildKeyRange() const { return build_key_range; }
+
 private:
     friend class NonJoinedBlockInputStream;
     friend class JoinSource;
@@ -356,6 +375,10 @@ private:
     std::shared_ptr<RightTableData> data;
     Sizes key_sizes;
 
+    /// Bit-cast [min, max] over the right-side keys, tracked for single integral join keys.
+    /// Updated under data->rwlock together with the maps.
+    std::optional<std::pair<UInt64, UInt64>> build_key_range;
+
     /// Block with columns from the right-side table.
     Block right_sample_block;
     /// Block with columns from the right-side table except key columns.
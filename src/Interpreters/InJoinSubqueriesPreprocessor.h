@@ -25,7 +25,10 @@ class Context;
   * then, according to setting 'distributed_product_mode',
   * either
   * - throw an exception;
-  * - or add GLOBAL to top subquery;
+  * - or add GLOBAL to top subquery: the subquery is then executed once on the initiator,
+  *   its result is stored into a temporary table and broadcast to every shard over the
+  *   connection protocol (see GlobalSubqueriesVisitor and Connection::sendExternalTablesData),
+  *   so shards build their JOIN/IN sets from the shipped blocks instead of re-running the subquery;
   * - or replace database and table name in subquery to remote database and table name,
   *   as Distributed storage on local server knows it.
   *
@@ -163,6 +163,14 @@ BlockIO InterpreterInsertQuery::execute()
 
     bool is_distributed_insert_select = false;
 
+    /// NOTE There is deliberately no "same schema, move compressed ranges" fast path for
+    /// INSERT SELECT between MergeTree tables. Compressed blocks in the source part do not align
+    /// with the rows a WHERE clause selects, granules of the destination part get their own marks
+    /// and primary index, and codecs may carry per-column state - so anything short of full
+    /// decompression only works for whole parts. The whole-part cases are already covered without
+    /// recompression: ALTER TABLE ... ATTACH/REPLACE PARTITION FROM hard-links part files, and
+    /// row deletion should go through ALTER DELETE, which rewrites only affected columns and
+    /// hard-links the rest, instead of copying the table through INSERT SELECT.
     if (query.select && table->isRemote() && settings.parallel_distributed_insert_select)
     {
         // Distributed INSERT SELECT
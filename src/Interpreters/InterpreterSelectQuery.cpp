@@ -1,3 +1,4 @@
+#include <DataStreams/BlocksListBlockInputStream.h>
 #include <DataStreams/OneBlockInputStream.h>
 #include <DataStreams/materializeBlock.h>
 
@@ -11,6 +12,7 @@
 #include <Parsers/ASTTablesInSelectQuery.h>
 #include <Parsers/ExpressionListParsers.h>
 #include <Parsers/parseQuery.h>
+#include <Parsers/queryToString.h>
 
 #include <Access/AccessFlags.h>
 
@@ -31,6 +33,8 @@
 
 #include <Processors/Pipe.h>
 #include <Processors/Sources/SourceFromInputStream.h>
+#include <Processors/Sources/NullSource.h>
+#include <Processors/Transforms/AggregationResultCacheTransform.h>
 #include <Processors/Transforms/ExpressionTransform.h>
 #include <Processors/Transforms/InflatingExpressionTransform.h>
 #include <Processors/Transforms/AggregatingTransform.h>
@@ -67,9 +71,11 @@
 #include <TableFunctions/ITableFunction.h>
 
 #include <Functions/IFunction.h>
+#include <Functions/FunctionFactory.h>
 #include <Core/Field.h>
 #include <Core/Types.h>
 #include <Columns/Collator.h>
+#include <Common/FieldVisitors.h>
 #include <Common/FieldVisitorsAccurateComparison.h>
 #include <Common/typeid_cast.h>
 #include <Common/checkStackSize.h>
@@ -211,6 +217,15 @@ static void rewriteMultipleJoins(ASTPtr & query, const TablesWithColumns & table
     JoinToSubqueryTransformVisitor(join_to_subs_data).visit(query);
 }
 
+/** NOTE: All of the analysis below is redone from scratch for every query, even for streams of
+  * identical point lookups that differ only in literals. Caching the analyzed actions or the
+  * pipeline skeleton across executions is not possible in the current design: the interpreter
+  * takes a table lock and a metadata snapshot that must match the part set of this execution,
+  * expression actions capture the Context (settings, access rights, row policies), and constant
+  * folding bakes the literal values into the actions themselves (e.g. the PREWHERE/WHERE rewrite
+  * in the constructor). A prepared-query path would first need actions that are pure functions
+  * of (normalized AST, metadata version).
+  */
 InterpreterSelectQuery::InterpreterSelectQuery(
     const ASTPtr & query_ptr_,
     const Context & context_,
@@ -253,6 +268,11 @@ InterpreterSelectQuery::InterpreterSelectQuery(
 
     JoinedTables joined_tables(getSubqueryContext(*context), getSelectQuery());
 
+    /// Reorder the join before the left table storage is resolved and locked.
+    if (!has_input && !storage && settings.optimize_join_swap_tables
+        && joined_tables.tablesCount() == 2 && joined_tables.trySwapJoinTables(getSelectQuery()))
+        joined_tables.reset(getSelectQuery());
+
     if (!has_input && !storage)
         storage = joined_tables.getLeftTableStorage();
 
@@ -480,14 +500,133 @@ void InterpreterSelectQuery::buildQueryPlan(QueryPlan & query_plan)
     }
 }
 
+/// Whether the query calls a non-deterministic function (now(), rand(), ...).
+/// Results of such queries change while the set of data parts does not, so they must not be cached.
+static bool hasNonDeterministicFunctions(const ASTPtr & node, const Context & context)
+{
+    if (const auto * function = node->as<ASTFunction>())
+    {
+        /// Aggregate functions are not in the factory; over a fixed set of parts they are deterministic.
+        if (const auto func = FunctionFactory::instance().tryGet(function->name, context))
+            if (!func->isDeterministic())
+                return true;
+    }
+
+    for (const auto & child : node->children)
+        if (hasNonDeterministicFunctions(child, context))
+            return true;
+
+    return false;
+}
+
+std::optional<UInt128> InterpreterSelectQuery::aggregationResultCacheKey(std::shared_ptr<AggregationResultCache> & cache)
+{
+    const Settings & settings = context->getSettingsRef();
+
+    if (!settings.use_aggregation_result_cache || options.only_analyze
+        || options.to_stage != QueryProcessingStage::Complete
+        || input || input_pipe)
+        return {};
+
+    if (!query_analyzer->hasAggregation())
+        return {};
+
+    /// Only the data parts of the main table are validated by the key,
+    /// so queries that also read other tables cannot be cached.
+    if (getSelectQuery().join())
+        return {};
+
+    /// The cached entry has no extremes, so it cannot serve a query that asks for them.
+    if (settings.extremes)
+        return {};
+
+    const auto * merge_tree = dynamic_cast<const MergeTreeData *>(storage.get());
+    if (!merge_tree)
+        return {};
+
+    if (hasNonDeterministicFunctions(query_ptr, *context))
+        return {};
+
+    cache = context->getAggregationResultCache();
+    if (!cache)
+        return {};
+
+    SipHash hash;
+
+    /// The same query text may resolve to different tables in a different database.
+    hash.update(context->getCurrentDatabase());
+    hash.update(queryToString(query_ptr));
+
+    /// The rows the query sees depend on who runs it: row policies filter the table per user.
+    /// The policy condition itself is hashed too, so changing a policy invalidates old entries.
+    hash.update(context->getUserName());
+    auto table_id = merge_tree->getStorageID();
+    if (auto filter = context->getRowPolicyCondition(table_id.database_name, table_id.table_name, RowPolicy::SELECT_FILTER))
+        hash.update(queryToString(filter));
+
+    /// Settings changed from the defaults may change the result (group_by_overflow_mode,
+    /// totals_mode, aggregate_functions_null_for_empty, ...). Hashing all changes is coarser
+    /// than listing the result-affecting ones, but it cannot go stale when a setting is added.
+    for (const auto & change : context->getSettingsRef().changes())
+    {
+        hash.update(change.name);
+        hash.update(applyVisitor(FieldVisitorToString(), change.value));
+    }
+
+    Strings part_names;
+    for (const auto & part : merge_tree->getDataPartsVector())
+        part_names.emplace_back(part->name);
+    std::sort(part_names.begin(), part_names.end());
+    for (const auto & name : part_names)
+        hash.update(name);
+
+    UInt128 key;
+    hash.get128(key.low, key.high);
+    return key;
+}
+
+
 BlockIO InterpreterSelectQuery::execute()
 {
     BlockIO res;
     QueryPlan query_plan;
 
+    AggregationResultCachePtr aggregation_result_cache;
+    std::optional<UInt128> aggregation_cache_key = aggregationResultCacheKey(aggregation_result_cache);
+
+    if (aggregation_cache_key)
+    {
+        if (auto result = aggregation_result_cache->get(*aggregation_cache_key))
+        {
+            /// Replay as one stream: the blocks are stored in the order the query produced
+            /// them, and parallel sources would interleave them arbitrarily (breaks ORDER BY).
+            if (result->blocks.empty())
+                res.pipeline.init(Pipe(std::make_shared<NullSource>(result->header)));
+            else
+                res.pipeline.init(Pipe(std::make_shared<SourceFromInputStream>(
+                    std::make_shared<BlocksListBlockInputStream>(
+                        BlocksList(result->blocks.begin(), result->blocks.end())))));
+            return res;
+        }
+    }
+
     buildQueryPlan(query_plan);
 
     res.pipeline = std::move(*query_plan.buildQueryPipeline());
+
+    if (aggregation_cache_key && !res.pipeline.hasTotals())
+    {
+        auto state = std::make_shared<AggregationResultCacheTransform::SharedState>();
+        res.pipeline.addSimpleTransform([&](const Block & header, Pipe::StreamType stream_type) -> ProcessorPtr
+        {
+            if (stream_type != Pipe::StreamType::Main)
+                return nullptr;
+
+            return std::make_shared<AggregationResultCacheTransform>(
+                header, aggregation_result_cache, *aggregation_cache_key, state);
+        });
+    }
+
     return res;
 }
 
@@ -1473,6 +1612,9 @@ void InterpreterSelectQuery::executeAggregation(QueryPlan & query_plan, const Ex
                               settings.max_threads,
                               settings.min_free_disk_space_for_temporary_data);
 
+    params.max_bytes_ratio_before_external_group_by = settings.max_bytes_ratio_before_external_group_by;
+    params.two_level_merge = settings.aggregation_two_level_merge;
+
     SortDescription group_by_sort_description;
 
     if (group_by_info && settings.optimize_aggregation_in_order)
@@ -3,6 +3,7 @@
 #include <memory>
 
 #include <Core/QueryProcessingStage.h>
+#include <Common/UInt128.h>
 #include <Parsers/ASTSelectQuery.h>
 #include <DataStreams/IBlockStream_fwd.h>
 #include <Interpreters/ExpressionActions.h>
@@ -25,6 +26,7 @@ struct SubqueryForSet;
 class InterpreterSelectWithUnionQuery;
 class Context;
 class QueryPlan;
+class AggregationResultCache;
 
 struct TreeRewriterResult;
 using TreeRewriterResultPtr = std::shared_ptr<const TreeRewriterResult>;
@@ -109,6 +111,10 @@ private:
 
     Block getSampleBlockImpl();
 
+    /// Returns the cache key if the result of this query can be served from (and stored into)
+    /// the aggregation result cache, and fills `cache`. Returns nothing otherwise.
+    std::optional<UInt128> aggregationResultCacheKey(std::shared_ptr<AggregationResultCache> & cache);
+
     void executeImpl(QueryPlan & query_plan, const BlockInputStreamPtr & prepared_input, std::optional<Pipe> prepared_pipe);
 
     /// Different stages of query execution.
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <memory>
+
+#include <Common/LRUCache.h>
+#include <Common/ProfileEvents.h>
+#include <Common/SipHash.h>
+#include <Core/Types.h>
+#include <Interpreters/IJoin.h>
+
+
+namespace ProfileEvents
+{
+    extern const Event JoinCacheHits;
+    extern const Event JoinCacheMisses;
+}
+
+namespace DB
+{
+
+struct JoinCacheWeightFunction
+{
+    size_t operator()(const IJoin & join) const
+    {
+        return join.getTotalByteCount();
+    }
+};
+
+
+/** Cache of built join tables, shared between queries that join against the same
+  * slowly-changing right-hand table. The fingerprint of the table's data parts is mixed
+  * into the key, so inserts and merges make old entries unreachable and they age out by LRU.
+  *
+  * Only hash joins of kinds that do not mutate the table while probing may be stored here:
+  * RIGHT/FULL (and the flagged ANY/SEMI/ANTI variants) track per-row "used" flags inside
+  * the table, and MergeJoin may own temporary files, so those are never shared.
+  */
+class JoinCache : public LRUCache<UInt128, IJoin, UInt128TrivialHash, JoinCacheWeightFunction>
+{
+private:
+    using Base = LRUCache<UInt128, IJoin, UInt128TrivialHash, JoinCacheWeightFunction>;
+
+public:
+    JoinCache(size_t max_size_in_bytes)
+        : Base(max_size_in_bytes) {}
+
+    MappedPtr get(const Key & key)
+    {
+        auto result = Base::get(key);
+        if (result)
+            ProfileEvents::increment(ProfileEvents::JoinCacheHits);
+        else
+            ProfileEvents::increment(ProfileEvents::JoinCacheMisses);
+
+        return result;
+    }
+};
+
+using JoinCachePtr = std::shared_ptr<JoinCache>;
+
+}
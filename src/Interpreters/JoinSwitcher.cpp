@@ -54,6 +54,10 @@ void JoinSwitcher::switchJoin()
     BlocksList right_blocks = std::move(joined_data->blocks);
 
     /// Destroy old join & create new one. Early destroy for memory saving.
+    /// We are switching because memory is exhausted, so release the hash maps and the arena
+    /// (not only the HashJoin object, which joined_data would otherwise keep alive)
+    /// before MergeJoin starts to accumulate the same data again.
+    joined_data.reset();
     join = std::make_shared<MergeJoin>(table_join, right_sample_block);
 
     /// names to positions optimization
@@ -70,8 +74,10 @@ void JoinSwitcher::switchJoin()
         }
     }
 
-    for (Block & saved_block : right_blocks)
+    while (!right_blocks.empty())
     {
+        Block & saved_block = right_blocks.front();
+
         Block restored_block;
         for (size_t i = 0; i < positions.size(); ++i)
         {
@@ -79,6 +85,10 @@ void JoinSwitcher::switchJoin()
             restored_block.insert(correctNullability(std::move(column), is_nullable[i]));
         }
         join->addJoinedBlock(restored_block);
+
+        /// Free the saved block (and whatever columns were not moved out of it) right away,
+        /// so that the peak memory usage during the switch stays one block, not the whole table.
+        right_blocks.pop_front();
     }
 
     switched = true;
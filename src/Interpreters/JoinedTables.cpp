@@ -62,6 +62,21 @@ void replaceJoinedTable(const ASTSelectQuery & select_query)
     }
 }
 
+/// Row count of a plain table expression (no subqueries, table functions or modifiers),
+/// cheaply taken from storage metadata. Empty if it cannot be estimated.
+std::optional<UInt64> estimateTableRows(const ASTTableExpression & table_expr, const Context & context)
+{
+    if (!table_expr.database_and_table_name || table_expr.final || table_expr.sample_size)
+        return {};
+
+    auto table_id = context.resolveStorageID(table_expr.database_and_table_name);
+    StoragePtr table = DatabaseCatalog::instance().tryGetTable(table_id, context);
+    if (!table)
+        return {};
+
+    return table->totalRows();
+}
+
 class RenameQualifiedIdentifiersMatcher
 {
 public:
@@ -225,6 +240,45 @@ void JoinedTables::makeFakeTable(StoragePtr storage, const StorageMetadataPtr &
         tables_with_columns.emplace_back(DatabaseAndTableWithAlias{}, source_header.getNamesAndTypesList());
 }
 
+bool JoinedTables::trySwapJoinTables(const ASTSelectQuery & select_query)
+{
+    /// Only the simplest shape: two plain tables, no ARRAY JOIN mixed in.
+    if (table_expressions.size() != 2 || select_query.arrayJoinExpressionList())
+        return false;
+
+    const ASTTablesInSelectQueryElement * join = select_query.join();
+    if (!join || !join->table_expression || !join->table_join)
+        return false;
+
+    /// Swapping sides must not change the result: restrict to local ALL INNER JOIN.
+    const auto & table_join = join->table_join->as<ASTTableJoin &>();
+    if (table_join.kind != ASTTableJoin::Kind::Inner || table_join.locality == ASTTableJoin::Locality::Global)
+        return false;
+
+    const auto & settings = context.getSettingsRef();
+    if (table_join.strictness != ASTTableJoin::Strictness::All
+        && !(table_join.strictness == ASTTableJoin::Strictness::Unspecified
+             && settings.join_default_strictness == JoinStrictness::ALL))
+        return false;
+
+    auto & left_element = select_query.tables()->children[0]->as<ASTTablesInSelectQueryElement &>();
+    auto & right_element = const_cast<ASTTablesInSelectQueryElement &>(*join);
+
+    auto left_rows = estimateTableRows(left_element.table_expression->as<ASTTableExpression &>(), context);
+    auto right_rows = estimateTableRows(right_element.table_expression->as<ASTTableExpression &>(), context);
+    if (!left_rows || !right_rows || *right_rows <= *left_rows)
+        return false;
+
+    /// The right table is the build side of HashJoin: put the smaller one there.
+    /// Column names do not change, so ON/USING and the rest of the query stay valid.
+    std::swap(left_element.table_expression, right_element.table_expression);
+    std::replace(left_element.children.begin(), left_element.children.end(),
+                 right_element.table_expression, left_element.table_expression);
+    std::replace(right_element.children.begin(), right_element.children.end(),
+                 left_element.table_expression, right_element.table_expression);
+    return true;
+}
+
 void JoinedTables::rewriteDistributedInAndJoins(ASTPtr & query)
 {
     /// Rewrite IN and/or JOIN for distributed tables according to distributed_product_mode setting.
@@ -47,6 +47,11 @@ public:
 
     void rewriteDistributedInAndJoins(ASTPtr & query);
 
+    /// Put the smaller of two plain tables to the right (build) side of a simple INNER JOIN,
+    /// comparing total row counts from storage metadata. Returns true if tables were swapped;
+    /// the caller should reset() then. Controlled by the optimize_join_swap_tables setting.
+    bool trySwapJoinTables(const ASTSelectQuery & select_query);
+
     std::unique_ptr<InterpreterSelectWithUnionQuery> makeLeftTableSubquery(const SelectQueryOptions & select_options);
 
 private:
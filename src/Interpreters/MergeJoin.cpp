@@ -592,7 +592,11 @@ bool MergeJoin::addJoinedBlock(const Block & src_block, bool)
 {
     Block block = modifyRightBlock(src_block);
 
-    sortBlock(block, right_sort_description);
+    /// MergeTree streams deliver blocks already ordered by the join key when it is a prefix
+    /// of the primary key. Detecting this is much cheaper than re-sorting: blocks that are
+    /// not sorted are rejected almost immediately by sampling a few rows.
+    if (!isAlreadySorted(block, right_sort_description))
+        sortBlock(block, right_sort_description);
     return saveRightBlock(std::move(block));
 }
 
@@ -604,7 +608,9 @@ void MergeJoin::joinBlock(Block & block, ExtraBlockPtr & not_processed)
         materializeBlockInplace(block);
         JoinCommon::removeLowCardinalityInplace(block, table_join->keyNamesLeft());
 
-        sortBlock(block, left_sort_description);
+        /// Same as for the right side: keep physically ordered blocks as they are.
+        if (!isAlreadySorted(block, left_sort_description))
+            sortBlock(block, left_sort_description);
 
         if (nullable_left_side)
             JoinCommon::convertColumnsToNullable(block);
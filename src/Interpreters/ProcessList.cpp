@@ -156,6 +156,7 @@ ProcessList::EntryPtr ProcessList::insert(const String & query_, const IAST * as
         res = std::make_shared<Entry>(*this, process_it);
 
         process_it->query_context = &query_context;
+        process_it->priority_preemption_timeout = std::chrono::milliseconds(settings.priority_preemption_timeout_ms.totalMilliseconds());
 
         ProcessListForUser & user_process_list = user_to_queries[client_info.current_user];
         user_process_list.queries.emplace(client_info.current_query_id, &res->get());
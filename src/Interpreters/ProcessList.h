@@ -97,6 +97,10 @@ protected:
 
     QueryPriorities::Handle priority_handle;
 
+    /// How long to stay frozen between blocks while higher priority queries are running.
+    /// Per-profile value, so query classes may be given different CPU shares under contention.
+    std::chrono::milliseconds priority_preemption_timeout{1000};
+
     CurrentMetrics::Increment num_queries_increment{CurrentMetrics::Query};
 
     std::atomic<bool> is_killed { false };
@@ -156,7 +160,7 @@ public:
         progress_in.incrementPiecewiseAtomically(value);
 
         if (priority_handle)
-            priority_handle->waitIfNeed(std::chrono::seconds(1));        /// NOTE Could make timeout customizable.
+            priority_handle->waitIfNeed(priority_preemption_timeout);
 
         return !is_killed.load(std::memory_order_relaxed);
     }
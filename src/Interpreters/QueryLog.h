@@ -18,6 +18,16 @@ namespace DB
   * - info about start of query execution;
   * - performance metrics (are set at the end of query execution);
   * - info about errors of query execution.
+  *
+  * NOTE: The "slow query postmortem bundle" is the set of system logs joined on query_id, and
+  * it is captured always-on without reproduction: this table holds the query text, settings,
+  * durations, peak memory and the full ProfileEvents map (cache hits/misses, waits, IO);
+  * query_thread_log breaks the same down per thread; trace_log holds the QueryProfiler stacks
+  * when query_profiler_*_time_period_ns are set; metric_log gives the server-wide backdrop.
+  * Filtering to offenders is done at read time (query_duration_ms predicate) rather than at
+  * capture time, because a latency threshold known only at query finish cannot retroactively
+  * enable collection. The one piece not persisted today is the pipeline graph with per
+  * -processor timings (see ExecutingGraph's counters) — that needs its own log table.
   */
 
 /// A struct which will be inserted as row into query_log table
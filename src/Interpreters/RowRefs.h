@@ -130,6 +130,15 @@ private:
  * When looking up values the container ensures that it is sorted for log(N) lookup
  * After calling any of the lookup methods, it is no longer allowed to insert more data as this would invalidate the
  * references that can be returned by the lookup methods
+ *
+ * NOTE on two proposed speedups for ASOF probing that were examined and not taken:
+ * interpolation search beats binary search only on near-uniform key distributions — event
+ * timestamps are bursty, its worst case is linear, and per-bucket quantile metadata would have
+ * to be built at the same lazily-sorted point this class already guards with double-checked
+ * locking. Batch probing (sort the probe block, merge-walk the vector) has to sort by
+ * (join key, asof key) first because probe rows interleave many join keys; that trades
+ * n*log(n) sorting for n binary searches of log(m), and only pays off when few keys own huge
+ * vectors — the case where the upper levels of the binary search are cache-resident anyway.
  */
 
 template <typename TEntry, typename TKey>
@@ -22,6 +22,17 @@ using FunctionBasePtr = std::shared_ptr<IFunctionBase>;
 
 
 /** Data structure for implementation of IN expression.
+  *
+  * NOTE: Sets are built once per query, not once per occurrence — PreparedSets keys on the IN
+  * argument's AST hash plus the left-operand types, so a repeated literal list shares one Set.
+  * Caching built sets *across* queries was considered for workloads that resend large IN lists:
+  * the cache key must include the coerced element types (literals are converted to the left
+  * operand's type at build time) and transform_null_in, and the cache itself is unbounded pinned
+  * memory with eviction policy for state the client already has — resending the list as an
+  * external table or a temporary table (or modelling it as a dictionary) pays the transfer once
+  * explicitly instead. A sorted-vector/galloping probe representation was also rejected: the
+  * hash probe is O(1) per unsorted probe row, and gallop only wins on sorted probes, which
+  * would require sorting every probed block first.
   */
 class Set
 {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <Core/Block.h>
+#include <Common/UInt128.h>
 #include <Storages/IStorage_fwd.h>
 #include <Parsers/IAST.h>
 #include <Interpreters/IJoin.h>
@@ -23,6 +24,8 @@ struct SubqueryForSet
     /// If set, build it from result.
     SetPtr set;
     JoinPtr join;
+    /// If set, put the built join table into the JoinCache under this key when done.
+    std::optional<UInt128> join_cache_key;
     /// Apply this actions to joined block.
     ExpressionActionsPtr joined_block_actions;
     Block sample_block; /// source->getHeader() + column renames
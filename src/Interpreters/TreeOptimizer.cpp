@@ -12,6 +12,7 @@
 #include <Interpreters/RedundantFunctionsInOrderByVisitor.h>
 #include <Interpreters/MonotonicityCheckVisitor.h>
 #include <Interpreters/ConvertStringsToEnumVisitor.h>
+#include <Interpreters/ConvertFunctionOrLikeVisitor.h>
 #include <Interpreters/PredicateExpressionsOptimizer.h>
 #include <Interpreters/Context.h>
 #include <Interpreters/ExternalDictionariesLoader.h>
@@ -588,6 +589,12 @@ void optimizeInjectiveFunctionsInsideUniq(ASTPtr & query, const Context & contex
     RemoveInjectiveFunctionsVisitor(data).visit(query);
 }
 
+void optimizeOrLikeChain(ASTPtr & query)
+{
+    ConvertFunctionOrLikeData data = {};
+    ConvertFunctionOrLikeVisitor(data).visit(query);
+}
+
 void transformIfStringsIntoEnum(ASTPtr & query)
 {
     std::unordered_set<String> function_names = {"if", "transform"};
@@ -675,6 +682,12 @@ void TreeOptimizer::apply(ASTPtr & query, Aliases & aliases, const NameSet & sou
     if (settings.optimize_if_transform_strings_to_enum)
         transformIfStringsIntoEnum(query);
 
+    /// Replace chains of same-column LIKE disjuncts with a single multiMatchAny.
+    /// multiMatchAny throws at execution time when hyperscan is disallowed, so do not
+    /// introduce it behind the user's back in that case.
+    if (settings.optimize_or_like_chain && settings.allow_hyperscan)
+        optimizeOrLikeChain(query);
+
     /// Remove duplicated elements from LIMIT BY clause.
     optimizeLimitBy(select_query);
 
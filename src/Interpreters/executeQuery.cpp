@@ -240,6 +240,16 @@ static void setQuerySpecificSettings(ASTPtr & ast, Context & context)
     }
 }
 
+/// NOTE: An initiator-side cache of whole query results (keyed by normalized query + settings
+/// + some data version of the involved tables) has been proposed repeatedly for dashboard-style
+/// workloads and deliberately not implemented here. Results are not a function of the query text
+/// alone: row policies and access rights make them user-dependent, and now()/today()/rand() and
+/// dictionary state make them time-dependent in ways a key cannot capture. There is also no cheap
+/// authoritative "data version" to key on: a part-set hash would have to be collected from every
+/// replica of every shard per lookup, which is a remote round-trip — the very thing the cache is
+/// supposed to save. Repeated identical dashboards are better served by an external cache that
+/// knows the product-level staleness budget, while this layer keeps the uncompressed and mark
+/// caches, which are safe because they are keyed by immutable part data.
 static std::tuple<ASTPtr, BlockIO> executeQueryImpl(
     const char * begin,
     const char * end,
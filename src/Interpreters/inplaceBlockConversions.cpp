@@ -159,6 +159,14 @@ void performRequiredConversions(Block & block, const NamesAndTypesList & require
     executeExpressionsOnBlock(block, conversion_expr_list, true, required_columns, context);
 }
 
+/// NOTE: This is less eager than it looks, so lazy-thunk columns would win little here.
+/// ALIAS columns are never materialized at read time at all — analysis substitutes their
+/// expression into the query, and SELECT expressions run after the WHERE filter. For DEFAULTs
+/// of physically missing columns, MergeTreeRangeReader evaluates this only on rows that
+/// survived PREWHERE when the column belongs to a later step of the read chain. The remaining
+/// eager case is a defaulted column used by WHERE itself (or read in the same step as the
+/// PREWHERE column), where the value is needed to decide survival anyway;
+/// optimize_move_to_prewhere narrows that case by default.
 void evaluateMissingDefaults(Block & block,
     const NamesAndTypesList & required_columns,
     const ColumnDefaults & column_defaults,
@@ -150,6 +150,15 @@ void loadMetadata(Context & context, const String & default_database_name)
     if (create_default_db_if_not_exists && !metadata_dir_for_default_db_already_exists)
         databases.emplace(default_database_name, path + "/" + escapeForFileName(default_database_name));
 
+    /// NOTE: Databases are loaded one after another, but nearly all startup work is already
+    /// parallel inside each database: DatabaseOrdinary attaches and starts up its tables on a
+    /// hardware-sized thread pool, dictionaries only register here and load lazily on first
+    /// use (dictionaries_lazy_load), and materialized views resolve their target tables at
+    /// first access, so no attach-time dependency graph is needed. Interleaving databases
+    /// would just re-divide the same pool. Accepting queries before the catalog is complete
+    /// was rejected: a query or DDL hitting a half-attached database would see spurious
+    /// "table does not exist" states and could race table creation against attach, so the
+    /// listeners deliberately start after this function returns.
     for (const auto & [name, db_path] : databases)
         loadDatabase(context, name, db_path, has_force_restore_data_flag);
 
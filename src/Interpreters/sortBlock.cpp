@@ -134,6 +134,14 @@ void sortBlock(Block & block, const SortDescription & description, UInt64 limit)
             int nan_direction_hint = description[0].nulls_direction;
             auto special_sort = description[0].special_sort;
 
+            /// NOTE: For a numeric column this is already a radix sort, not a comparison sort:
+            /// ColumnVector::getPermutation uses RadixSort::executeLSD for full sorts of
+            /// arithmetic types above 256 rows, handling descending order and the NaN direction
+            /// and emitting the permutation applied below; Nullable keys go through
+            /// ColumnNullable, which radix-sorts the nested column and places nulls.
+            /// pdqsort remains for small sizes, 128-bit types and the limit (partial sort) path,
+            /// where a radix pass over all rows would do more work than it saves.
+
             if (special_sort == SpecialSort::OPENCL_BITONIC)
                 column->getSpecialPermutation(reverse, limit, nan_direction_hint, perm, IColumn::SpecialSort::OPENCL_BITONIC);
             else
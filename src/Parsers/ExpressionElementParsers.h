@@ -231,6 +231,14 @@ protected:
   * We try to parse the array or tuple as a collection of literals first (fast path),
   *  and if it did not work out (when the collection consists of complex expressions) -
   *  parse as an application of [] operator or 'tuple' function (slow path).
+  *
+  * NOTE: This is what keeps huge generated IN-lists cheap: the million-element list becomes
+  * one ASTLiteral holding a Field Array instead of a million AST nodes, so neither the parser
+  * nor the analyzer ever walks the elements individually. An arena allocator with bulk free
+  * for the remaining AST nodes does not fit the ownership model: ASTs outlive parsing
+  * (prepared sets, mutation commands, view definitions hold shared_ptr subtrees), so there is
+  * no single point where the whole tree can be freed; per-node counts after this fast path
+  * are proportional to query text written by a human, not by a generator.
   */
 template <typename Collection>
 class ParserCollectionOfLiterals : public IParserBase
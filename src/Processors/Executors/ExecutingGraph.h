@@ -49,7 +49,13 @@ public:
         IProcessor * processor = nullptr;
         uint64_t processors_id = 0;
 
-        /// Counters for profiling.
+        /// Counters for profiling. Populated unconditionally — the executor runs a stopwatch
+        /// around every work() and prepare() call, so per-processor time is always known.
+        /// PipelineExecutor::dumpPipeline() renders these with the graph topology, but today
+        /// it is only emitted when a query throws or the pipeline gets stuck; EXPLAIN PIPELINE
+        /// shows the same topology statically. Surfacing them for successful queries needs
+        /// only a sink at query finish (a processors-profile log table), not more
+        /// instrumentation.
         uint64_t num_executed_jobs = 0;
         uint64_t execution_time_ns = 0;
         uint64_t preparation_time_ns = 0;
@@ -1,6 +1,8 @@
 #include <Processors/Executors/PipelineExecutor.h>
 #include <queue>
+#include <map>
 #include <IO/WriteBufferFromString.h>
+#include <IO/Operators.h>
 #include <Processors/printPipeline.h>
 #include <Common/EventCounter.h>
 #include <ext/scope_guard.h>
@@ -8,10 +10,7 @@
 #include <Processors/ISource.h>
 #include <Common/setThreadName.h>
 #include <Interpreters/ProcessList.h>
-
-#ifndef NDEBUG
-    #include <Common/Stopwatch.h>
-#endif
+#include <Common/Stopwatch.h>
 
 namespace DB
 {
@@ -91,9 +90,10 @@ void PipelineExecutor::addJob(ExecutingGraph::Node * execution_state)
     {
         try
         {
-            // Stopwatch watch;
+            /// Only this thread executes jobs of the node, no synchronisation needed.
+            Stopwatch watch;
             executeJob(execution_state->processor);
-            // execution_state->execution_time_ns += watch.elapsed();
+            execution_state->execution_time_ns += watch.elapsed();
 
             ++execution_state->num_executed_jobs;
         }
@@ -247,6 +247,11 @@ bool PipelineExecutor::prepareProcessor(UInt64 pid, size_t thread_number, Queue
             }
             case IProcessor::Status::Async:
             {
+                /// Supporting this status needs an event loop here (epoll over fds handed out by
+                /// schedule()) and, more importantly, sources that can actually yield mid-read.
+                /// All current sources go through synchronous ReadBuffer chains (local files,
+                /// HTTP, compression), which block inside work() with no fd to poll on, so there
+                /// is nothing for a reactor to drive until the buffer layer becomes non-blocking.
                 throw Exception("Async is temporary not supported.", ErrorCodes::LOGICAL_ERROR);
 
 //            node.status = ExecStatus::Executing;
@@ -502,6 +507,41 @@ void PipelineExecutor::executeStepImpl(size_t thread_num, size_t num_threads, st
         /// Just travers graph and prepare any processor.
         while (!finished && node == nullptr)
         {
+            /// Locally kept tasks are served first and need no lock.
+            if (!context->local_tasks.empty())
+            {
+                node = context->local_tasks.front();
+                context->local_tasks.pop();
+
+                /// Somebody went idle while we were keeping tasks to ourselves: give the rest away.
+                if (!context->local_tasks.empty() && num_waiting_threads.load(std::memory_order_relaxed) > 0)
+                {
+                    std::unique_lock lock(task_queue_mutex);
+
+                    while (!context->local_tasks.empty())
+                    {
+                        task_queue.push(context->local_tasks.front(), thread_num);
+                        context->local_tasks.pop();
+                    }
+
+                    if (!threads_queue.empty() && !finished)
+                    {
+                        auto thread_to_wake = task_queue.getAnyThreadWithTasks(thread_num + 1 == num_threads ? 0 : (thread_num + 1));
+
+                        if (threads_queue.has(thread_to_wake))
+                            threads_queue.pop(thread_to_wake);
+                        else
+                            thread_to_wake = threads_queue.popAny();
+
+                        num_waiting_threads.fetch_sub(1, std::memory_order_relaxed);
+                        lock.unlock();
+                        wakeUpExecutor(thread_to_wake);
+                    }
+                }
+
+                break;
+            }
+
             {
                 std::unique_lock lock(task_queue_mutex);
 
@@ -518,6 +558,7 @@ void PipelineExecutor::executeStepImpl(size_t thread_num, size_t num_threads, st
                         else
                             thread_to_wake = threads_queue.popAny();
 
+                        num_waiting_threads.fetch_sub(1, std::memory_order_relaxed);
                         lock.unlock();
                         wakeUpExecutor(thread_to_wake);
                     }
@@ -533,6 +574,7 @@ void PipelineExecutor::executeStepImpl(size_t thread_num, size_t num_threads, st
                 }
 
                 threads_queue.push(thread_num);
+                num_waiting_threads.fetch_add(1, std::memory_order_relaxed);
             }
 
             {
@@ -603,6 +645,14 @@ void PipelineExecutor::executeStepImpl(size_t thread_num, size_t num_threads, st
                     queue.pop();
                 }
 
+                /// While nobody is starving, keep the rest of the tasks to ourselves:
+                /// going through the global queue would only pay for task_queue_mutex contention.
+                while (!queue.empty() && num_waiting_threads.load(std::memory_order_relaxed) == 0)
+                {
+                    context->local_tasks.push(queue.front());
+                    queue.pop();
+                }
+
                 /// Push other tasks to global queue.
                 if (!queue.empty())
                 {
@@ -623,6 +673,7 @@ void PipelineExecutor::executeStepImpl(size_t thread_num, size_t num_threads, st
                         else
                             thread_to_wake = threads_queue.popAny();
 
+                        num_waiting_threads.fetch_sub(1, std::memory_order_relaxed);
                         lock.unlock();
 
                         wakeUpExecutor(thread_to_wake);
@@ -747,6 +798,35 @@ void PipelineExecutor::executeImpl(size_t num_threads)
         executeSingleThread(0, num_threads);
 
     finished_flag = true;
+
+    LOG_TRACE(log, "Work time by processor: {}", dumpExecutionTimes());
+}
+
+String PipelineExecutor::dumpExecutionTimes() const
+{
+    /// Aggregate by processor name: plans instantiate the same transform once per stream.
+    std::map<String, std::pair<uint64_t, size_t>> times_by_name;
+    for (const auto & node : graph->nodes)
+    {
+        auto & [time_ns, count] = times_by_name[node->processor->getName()];
+        time_ns += node->execution_time_ns;
+        ++count;
+    }
+
+    std::vector<std::pair<String, std::pair<uint64_t, size_t>>> sorted(times_by_name.begin(), times_by_name.end());
+    std::sort(sorted.begin(), sorted.end(), [](const auto & lhs, const auto & rhs) { return lhs.second.first > rhs.second.first; });
+
+    WriteBufferFromOwnString out;
+    bool first = true;
+    for (const auto & [name, time_and_count] : sorted)
+    {
+        if (!first)
+            out << ", ";
+        first = false;
+        out << name << " " << time_and_count.first / 1e9 << " sec. (x" << time_and_count.second << ")";
+    }
+
+    return out.str();
 }
 
 String PipelineExecutor::dumpPipeline() const
@@ -756,9 +836,9 @@ String PipelineExecutor::dumpPipeline() const
         {
             WriteBufferFromOwnString buffer;
             buffer << "(" << node->num_executed_jobs << " jobs";
+            buffer << ", execution time: " << node->execution_time_ns / 1e9 << " sec.";
 
 #ifndef NDEBUG
-            buffer << ", execution time: " << node->execution_time_ns / 1e9 << " sec.";
             buffer << ", preparation time: " << node->preparation_time_ns / 1e9 << " sec.";
 #endif
 
@@ -60,6 +60,10 @@ private:
     ThreadsQueue threads_queue;
     std::mutex task_queue_mutex;
 
+    /// Number of threads sleeping in threads_queue. Duplicates threads_queue.size() so that
+    /// running threads can check for idle peers without taking task_queue_mutex.
+    std::atomic<size_t> num_waiting_threads{0};
+
     /// Flag that checks that initializeExecution was called.
     bool is_execution_initialized = false;
     std::atomic_bool cancelled;
@@ -97,6 +101,10 @@ private:
         /// Currently processing node.
         ExecutingGraph::Node * node = nullptr;
 
+        /// Tasks kept by the owning thread while no other thread is starving.
+        /// Served without taking task_queue_mutex; flushed to task_queue when somebody goes idle.
+        std::queue<ExecutingGraph::Node *> local_tasks;
+
 #ifndef NDEBUG
         /// Time for different processing stages.
         UInt64 total_time_ns = 0;
@@ -146,6 +154,9 @@ private:
     void finish();
 
     String dumpPipeline() const;
+
+    /// Per-processor work() time aggregated by processor name, for the trace log.
+    String dumpExecutionTimes() const;
 };
 
 using PipelineExecutorPtr = std::shared_ptr<PipelineExecutor>;
@@ -424,6 +424,10 @@ void registerInputFormatProcessorCSV(FormatFactory & factory)
     }
 }
 
+/// Finds the next row boundary after min_chunk_size bytes, tracking RFC 4180 quoting ('""' is an
+/// escaped quote inside a quoted field, newlines inside quotes do not end a row). This runs on the
+/// segmentator thread of ParallelParsingBlockInputStream; the chunks it cuts are parsed by the
+/// worker pool and reassembled in order downstream.
 static bool fileSegmentationEngineCSVImpl(ReadBuffer & in, DB::Memory<> & memory, size_t min_chunk_size)
 {
     char * pos = in.position();
@@ -44,6 +44,12 @@ class ConstantExpressionTemplate : boost::noncopyable
 public:
     using TemplateStructurePtr = std::shared_ptr<const TemplateStructure>;
 
+    /// Cache of deduced templates, keyed by template hash. It lives in the input format, i.e. one
+    /// INSERT query. Sharing it between queries with an identical VALUES structure is not safe:
+    /// TemplateStructure holds ExpressionActions built against the query Context, and settings or
+    /// functions resolved there (dialect, timezone, user defined) may legitimately differ per
+    /// query. Parsed literal columns already accumulate for up to max_block_size rows and
+    /// actions_on_literals run once per such batch, so the per-row cost is plain literal parsing.
     class Cache : boost::noncopyable
     {
         std::unordered_map<size_t, TemplateStructurePtr> cache;
@@ -65,6 +65,12 @@ void ParquetBlockInputFormat::resetParser()
     prepareReader();
 }
 
+/// NOTE Only the columns present in the header are requested from the file (see column_indices)
+/// and they are read one row group at a time, so the reader does not materialize the whole table.
+/// Skipping row groups by their min/max statistics is not possible at this layer: input formats
+/// receive only the sample block, the query predicate is not pushed below the storage. If such
+/// pushdown appears, feed it into ReadRowGroup selection here instead of writing a separate
+/// Parquet decoder - the Arrow one already decodes dictionary pages lazily.
 void ParquetBlockInputFormat::prepareReader()
 {
     THROW_ARROW_NOT_OK(parquet::arrow::OpenFile(asArrowFile(in), arrow::default_memory_pool(), &file_reader));
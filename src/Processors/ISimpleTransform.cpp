@@ -84,6 +84,15 @@ void ISimpleTransform::work()
         return;
     }
 
+    /// A cancelled query does not need the result: do not start work on a pending chunk,
+    /// so the thread (and the query slot it occupies) is released sooner after KILL QUERY.
+    if (isCancelled())
+    {
+        input_data.chunk.clear();
+        has_input = false;
+        return;
+    }
+
     try
     {
         transform(input_data.chunk, output_data.chunk);
@@ -13,6 +13,16 @@ namespace ErrorCodes
 
 /** Has one input and one output.
   * Simply pull a block from input, transform it, and push it to output.
+  *
+  * NOTE On allocation churn in linear pipelines. A pool of detached column buffers that
+  * transforms could draw on was considered and rejected: IColumn implementations own their
+  * PODArrays internally, so adopting a recycled buffer would need a new "rebind storage" API on
+  * every column type, and a pooled buffer rarely matches the exact char/offset sizes the next
+  * chunk needs. The mechanism this codebase already has for the same goal is COW: a transform
+  * that receives the only reference to a column (use_count == 1) can IColumn::mutate() it and
+  * work in place without any allocation - this is what the arithmetic and expression code paths
+  * do. Operations that change the number of rows (filter, expand) produce columns of a different
+  * size and have to allocate regardless.
   */
 class ISimpleTransform : public IProcessor
 {
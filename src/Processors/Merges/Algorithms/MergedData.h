@@ -32,6 +32,18 @@ public:
         sum_blocks_granularity += block_size;
     }
 
+    /// Insert a run of consecutive rows of one source with a single batch call per column.
+    void insertRows(const ColumnRawPtrs & raw_columns, size_t start_row, size_t num_rows, size_t block_size)
+    {
+        size_t num_columns = raw_columns.size();
+        for (size_t i = 0; i < num_columns; ++i)
+            columns[i]->insertRangeFrom(*raw_columns[i], start_row, num_rows);
+
+        total_merged_rows += num_rows;
+        merged_rows += num_rows;
+        sum_blocks_granularity += block_size * num_rows;
+    }
+
     void insertFromChunk(Chunk && chunk, size_t limit_rows)
     {
         if (merged_rows)
@@ -97,6 +109,7 @@ public:
         return merged_rows >= average;
     }
 
+    UInt64 maxBlockSize() const { return max_block_size; }
     UInt64 mergedRows() const { return merged_rows; }
     UInt64 totalMergedRows() const { return total_merged_rows; }
     UInt64 totalChunks() const { return total_chunks; }
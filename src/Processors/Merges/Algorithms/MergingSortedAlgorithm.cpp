@@ -94,6 +94,40 @@ IMergingAlgorithm::Status MergingSortedAlgorithm::merge()
         return mergeImpl(queue_without_collation);
 }
 
+namespace
+{
+
+/// How many rows the top cursor can output before a row of the next best cursor must go first.
+/// Rows of one block are sorted, so it is a binary search for the first row of the top cursor
+/// that must go after the next cursor's current row. Uses the same comparison as the queue
+/// (including the tiebreak by source order), so the result is identical to popping row by row.
+template <typename TSortingHeap>
+size_t currentRunLength(TSortingHeap & queue)
+{
+    auto current = queue.current();
+
+    if (queue.size() == 1)
+        return current->rows - current->pos;
+
+    auto & next = queue.nextChild();
+
+    size_t low = current->pos;  /// The current row is on top of the queue, so it goes first.
+    size_t high = current->rows;
+
+    while (high - low > 1)
+    {
+        size_t mid = (low + high) / 2;
+        if (current.greaterAt(next, mid, next->pos))
+            high = mid;
+        else
+            low = mid;
+    }
+
+    return low - current->pos + 1;
+}
+
+}
+
 template <typename TSortingHeap>
 IMergingAlgorithm::Status MergingSortedAlgorithm::mergeImpl(TSortingHeap & queue)
 {
@@ -138,19 +172,39 @@ IMergingAlgorithm::Status MergingSortedAlgorithm::mergeImpl(TSortingHeap & queue
         }
 
         //std::cerr << "total_merged_rows: " << total_merged_rows << ", merged_rows: " << merged_rows << "\n";
-        //std::cerr << "Inserting row\n";
-        merged_data.insertRow(current->all_columns, current->pos, current->rows);
+        //std::cerr << "Inserting rows\n";
+
+        /// All rows of the run would be output before any other cursor can interleave,
+        /// so materialize them with a single batch call per column instead of row by row.
+        size_t run_length = currentRunLength(queue);
+
+        /// The last row of the block is handled separately at the top of the loop (it may be skipped
+        /// or replaced by the next block of the same source).
+        if (current_inputs[current.impl->order].skip_last_row)
+            run_length = std::min<size_t>(run_length, current->rows - current->pos - 1);
+
+        /// Do not produce chunks larger than max_block_size.
+        run_length = std::min<size_t>(run_length, merged_data.maxBlockSize() - merged_data.mergedRows());
+
+        if (limit)
+            run_length = std::min<size_t>(run_length, limit - merged_data.totalMergedRows());
+
+        merged_data.insertRows(current->all_columns, current->pos, run_length, current->rows);
 
         if (out_row_sources_buf)
         {
             /// Actually, current.impl->order stores source number (i.e. cursors[current.impl->order] == current.impl)
             RowSourcePart row_source(current.impl->order);
-            out_row_sources_buf->write(row_source.data);
+            for (size_t i = 0; i < run_length; ++i)
+                out_row_sources_buf->write(row_source.data);
         }
 
         if (limit && merged_data.totalMergedRows() >= limit)
             return Status(merged_data.pull(), true);
 
+        /// The cursor now points to the last row of the inserted run.
+        current.impl->pos += run_length - 1;
+
         if (!current->isLast())
         {
             //std::cerr << "moving to next row\n";
@@ -52,7 +52,9 @@ void AggregatingStep::transformPipeline(QueryPipeline & pipeline)
     /// Forget about current totals and extremes. They will be calculated again after aggregation if needed.
     pipeline.dropTotalsAndExtremes();
 
-    bool allow_to_use_two_level_group_by = pipeline.getNumStreams() > 1 || params.max_bytes_before_external_group_by != 0;
+    bool allow_to_use_two_level_group_by = pipeline.getNumStreams() > 1
+        || params.max_bytes_before_external_group_by != 0
+        || params.max_bytes_ratio_before_external_group_by > 0.;
     if (!allow_to_use_two_level_group_by)
     {
         params.group_by_two_level_threshold = 0;
@@ -48,12 +48,18 @@ void PartialSortingStep::updateLimit(size_t limit_)
 
 void PartialSortingStep::transformPipeline(QueryPipeline & pipeline)
 {
+    /// With a LIMIT, parallel streams share the best cutoff found so far,
+    /// so all of them pre-filter rows that cannot be in the top LIMIT.
+    SortingSharedCutoffPtr shared_cutoff;
+    if (limit && pipeline.getNumStreams() > 1)
+        shared_cutoff = std::make_shared<SortingSharedCutoff>();
+
     pipeline.addSimpleTransform([&](const Block & header, QueryPipeline::StreamType stream_type) -> ProcessorPtr
     {
         if (stream_type != QueryPipeline::StreamType::Main)
             return nullptr;
 
-        return std::make_shared<PartialSortingTransform>(header, sort_description, limit);
+        return std::make_shared<PartialSortingTransform>(header, sort_description, limit, shared_cutoff);
     });
 
     IBlockInputStream::LocalLimits limits;
@@ -471,6 +471,55 @@ static void tryLiftUpArrayJoin(QueryPlan::Node * parent_node, QueryPlan::Node *
                     : filter_step->updateInputStream(array_join_step->getOutputStream(), true);
 }
 
+/// Replace chains Expression -> Expression and Expression -> Filter with a single step,
+/// executing both actions sequences in one pass over the block. This removes an extra
+/// processor from the pipeline together with its port handoffs per chunk.
+static void tryMergeExpressions(QueryPlan::Node * parent_node, QueryPlan::Node * child_node)
+{
+    auto & parent = parent_node->step;
+    auto & child = child_node->step;
+
+    auto * parent_expr = typeid_cast<ExpressionStep *>(parent.get());
+    auto * parent_filter = typeid_cast<FilterStep *>(parent.get());
+    auto * child_expr = typeid_cast<ExpressionStep *>(child.get());
+
+    if (!child_expr || !(parent_expr || parent_filter))
+        return;
+
+    const auto & child_actions = child_expr->getExpression();
+    const auto & parent_actions = parent_expr ? parent_expr->getExpression() : parent_filter->getExpression();
+
+    /// Actions with JOIN or ARRAY JOIN are not plain per-block calculations, do not touch them.
+    auto is_plain = [](const ExpressionActionsPtr & actions)
+    {
+        for (const auto & action : actions->getActions())
+            if (action.type == ExpressionAction::ARRAY_JOIN || action.type == ExpressionAction::JOIN)
+                return false;
+        return true;
+    };
+
+    if (!is_plain(child_actions) || !is_plain(parent_actions))
+        return;
+
+    /// Steps may share ExpressionActions with the analyzer, so build a new sequence.
+    auto merged = std::make_shared<ExpressionActions>(*child_actions);
+    for (const auto & action : parent_actions->getActions())
+        merged->add(action);
+
+    String description = parent->getStepDescription();
+    const auto & input_stream = child->getInputStreams().front();
+
+    if (parent_expr)
+        parent = std::make_unique<ExpressionStep>(input_stream, std::move(merged));
+    else
+        parent = std::make_unique<FilterStep>(input_stream, std::move(merged),
+                                              parent_filter->getFilterColumnName(),
+                                              parent_filter->removesFilterColumn());
+
+    parent->setStepDescription(std::move(description));
+    parent_node->children.swap(child_node->children);
+}
+
 void QueryPlan::optimize()
 {
     struct Frame
@@ -502,7 +551,10 @@ void QueryPlan::optimize()
         {
             /// Last entrance, try lift up.
             if (frame.node->children.size() == 1)
+            {
                 tryLiftUpArrayJoin(frame.node, frame.node->children.front(), nodes);
+                tryMergeExpressions(frame.node, frame.node->children.front());
+            }
 
             stack.pop();
         }
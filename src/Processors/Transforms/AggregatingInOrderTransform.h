@@ -9,6 +9,11 @@
 namespace DB
 {
 
+/// Aggregates blocks that arrive sorted by a prefix of the GROUP BY keys without a hash table:
+/// rows are folded into the current group's states and a group is emitted as soon as its key
+/// range is passed, so memory stays bounded by the result block size. Enabled by
+/// optimize_aggregation_in_order when the group keys form a prefix of the table's sorting key;
+/// the storage then reads parts in order and per-stream results are stitched by a final merge.
 class AggregatingInOrderTransform : public IProcessor
 {
 
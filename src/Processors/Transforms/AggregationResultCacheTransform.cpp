@@ -0,0 +1,79 @@
+#include <Processors/Transforms/AggregationResultCacheTransform.h>
+
+namespace DB
+{
+
+AggregationResultCacheTransform::AggregationResultCacheTransform(
+    const Block & header_, AggregationResultCachePtr cache_, UInt128 key_, SharedStatePtr state_)
+    : ISimpleTransform(header_, header_, false)
+    , cache(std::move(cache_))
+    , key(key_)
+    , state(std::move(state_))
+{
+    std::lock_guard lock(state->mutex);
+    if (!state->result.header)
+        state->result.header = getInputPort().getHeader().cloneEmpty();
+    ++state->running_streams;
+}
+
+void AggregationResultCacheTransform::abort()
+{
+    state->aborted = true;
+    state->result.blocks.clear();
+}
+
+void AggregationResultCacheTransform::transform(Chunk & chunk)
+{
+    std::lock_guard lock(state->mutex);
+
+    if (state->aborted)
+        return;
+
+    Block block = getInputPort().getHeader().cloneWithColumns(chunk.getColumns());
+    state->result_bytes += block.allocatedBytes();
+
+    if (state->result_bytes > cache->maxEntrySize())
+        abort();
+    else
+        state->result.blocks.emplace_back(std::move(block));
+}
+
+void AggregationResultCacheTransform::work()
+{
+    if (input_data.exception)
+    {
+        std::lock_guard lock(state->mutex);
+        abort();
+    }
+
+    ISimpleTransform::work();
+}
+
+AggregationResultCacheTransform::Status AggregationResultCacheTransform::prepare()
+{
+    auto status = ISimpleTransform::prepare();
+
+    if (status == Status::Finished && !finish_reported)
+    {
+        finish_reported = true;
+        bool store = false;
+
+        {
+            std::lock_guard lock(state->mutex);
+
+            /// The query may be cancelled (e.g. by LIMIT) before all data has passed through.
+            if (!input.isFinished())
+                abort();
+
+            --state->running_streams;
+            store = state->running_streams == 0 && !state->aborted;
+        }
+
+        if (store)
+            cache->set(key, std::make_shared<AggregationResult>(std::move(state->result)));
+    }
+
+    return status;
+}
+
+}
@@ -0,0 +1,50 @@
+#pragma once
+
+#include <mutex>
+#include <Processors/ISimpleTransform.h>
+#include <Interpreters/AggregationResultCache.h>
+
+namespace DB
+{
+
+/** Passes chunks through unchanged and accumulates a copy of them (cheap, columns are shared).
+  * When the inputs of all transforms sharing the same state are fully read, the accumulated
+  * blocks are stored into AggregationResultCache under the given key. If any of the streams
+  * is cancelled before its input is exhausted, or an exception passes through, or the result
+  * grows too large, nothing is stored.
+  */
+class AggregationResultCacheTransform : public ISimpleTransform
+{
+public:
+    struct SharedState
+    {
+        std::mutex mutex;
+        AggregationResult result;
+        size_t result_bytes = 0;
+        size_t running_streams = 0;
+        bool aborted = false;
+    };
+
+    using SharedStatePtr = std::shared_ptr<SharedState>;
+
+    AggregationResultCacheTransform(
+        const Block & header_, AggregationResultCachePtr cache_, UInt128 key_, SharedStatePtr state_);
+
+    String getName() const override { return "AggregationResultCacheTransform"; }
+
+    Status prepare() override;
+    void work() override;
+
+protected:
+    void transform(Chunk & chunk) override;
+
+private:
+    AggregationResultCachePtr cache;
+    UInt128 key;
+    SharedStatePtr state;
+    bool finish_reported = false;
+
+    void abort();
+};
+
+}
@@ -6,7 +6,11 @@
 
 #include <Interpreters/Set.h>
 #include <Interpreters/IJoin.h>
+#include <Interpreters/HashJoin.h>
+#include <Interpreters/JoinCache.h>
+#include <Interpreters/Context.h>
 #include <Storages/IStorage.h>
+#include <Common/typeid_cast.h>
 
 #include <iomanip>
 #include <DataStreams/materializeBlock.h>
@@ -88,6 +92,14 @@ void CreatingSetsTransform::finishSubquery(SubqueryForSet & subquery)
 
     subquery.setTotals();
 
+    /// Share the built table with other queries. Only a plain HashJoin may be stored:
+    /// JoinSwitcher may have switched to MergeJoin, which owns temporary files.
+    if (subquery.join && subquery.join_cache_key && typeid_cast<HashJoin *>(subquery.join.get()))
+    {
+        if (auto join_cache = context.getJoinCache())
+            join_cache->set(*subquery.join_cache_key, subquery.join);
+    }
+
     if (head_rows != 0)
     {
         auto seconds = elapsed_nanoseconds / 1e9;
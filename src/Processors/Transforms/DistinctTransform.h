@@ -7,6 +7,17 @@
 namespace DB
 {
 
+/// Streaming DISTINCT: passes each first occurrence through immediately, keeping seen keys in
+/// an in-memory set. The streaming property is the point — DISTINCT ... LIMIT n finishes as soon
+/// as n distinct rows were seen.
+///
+/// NOTE: A disk-spilling mode was considered for cardinalities above max_bytes_in_distinct.
+/// Spilling is incompatible with this operator's shape: once keys are partitioned to disk a
+/// row's uniqueness is undecided until its partition is deduplicated, so the transform would
+/// have to hold rows back and become blocking — at which point it is aggregation. That operator
+/// already exists with a spill path: GROUP BY over the DISTINCT columns together with
+/// max_bytes_before_external_group_by completes within a memory budget and returns the same
+/// rows. The size limits here stay as the guardrail for the streaming form.
 class DistinctTransform : public ISimpleTransform
 {
 public:
@@ -14,6 +14,17 @@ using VolumePtr = std::shared_ptr<IVolume>;
 
 /// Takes sorted separate chunks of data. Sorts them.
 /// Returns stream with globally sorted data.
+///
+/// NOTE: When the sort spills (max_bytes_before_external_sort), the final fan-in of the
+/// temporary sorted runs is a single MergingSortedTransform. Range-partitioning that merge
+/// across threads (sample run boundaries, merge each key range from all runs independently,
+/// concatenate) was considered. It is not a local change: this transform has one output port
+/// that must emit blocks in global order, so parallel range merges need either an ordered
+/// concat node fed by per-range merge pipelines — a repartition exchange built at plan time,
+/// when the number of runs is not yet known — or out-of-order consumption downstream. The
+/// run-producing phase is already parallel (each upstream thread sorts and spills its own
+/// runs), and the merge itself is usually bounded by decompressing the runs, which parallel
+/// range merges over the same files would not reduce.
 class MergeSortingTransform : public SortingTransform
 {
 public:
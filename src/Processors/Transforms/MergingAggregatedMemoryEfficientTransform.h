@@ -23,6 +23,10 @@ namespace DB
   * Partially aggregated data arrives from different servers, which can be split down or not, into 256 buckets,
   *  and these buckets are passed to us by the network from each server in sequence, one by one.
   * You should also read and merge by the buckets.
+  * (This is what distributed_aggregation_memory_efficient enables: shards stream each finalized
+  *  bucket as soon as it is complete, same-id buckets are merged here on several threads, and each
+  *  merged bucket is released downstream immediately, so the initiator holds only a few buckets
+  *  instead of all 256 from every shard.)
   *
   * The essence of the work:
   *
@@ -6,9 +6,10 @@ namespace DB
 {
 
 PartialSortingTransform::PartialSortingTransform(
-    const Block & header_, SortDescription & description_, UInt64 limit_)
+    const Block & header_, SortDescription & description_, UInt64 limit_, SortingSharedCutoffPtr shared_cutoff_)
     : ISimpleTransform(header_, header_, false)
     , description(description_), limit(limit_)
+    , shared_cutoff(std::move(shared_cutoff_))
 {
 }
 
@@ -96,6 +97,21 @@ void PartialSortingTransform::transform(Chunk & chunk)
 
     auto block = getInputPort().getHeader().cloneWithColumns(chunk.detachColumns());
 
+    /// Maybe another stream has found a tighter cutoff in the meantime; adopt it if so.
+    if (shared_cutoff && shared_cutoff->version.load(std::memory_order_acquire) != seen_cutoff_version)
+    {
+        std::lock_guard lock(shared_cutoff->mutex);
+        seen_cutoff_version = shared_cutoff->version.load(std::memory_order_relaxed);
+
+        auto shared_columns = extractColumns(shared_cutoff->block, description);
+        if (threshold_block_columns.empty() ||
+            less(shared_columns, limit - 1, threshold_block_columns, limit - 1, description))
+        {
+            threshold_block = shared_cutoff->block;
+            threshold_block_columns = extractColumns(threshold_block, description);
+        }
+    }
+
     /** If we've saved columns from previously blocks we could filter all rows from current block
       * which are unnecessary for sortBlock(...) because they obviously won't be in the top LIMIT rows.
       */
@@ -122,7 +138,7 @@ void PartialSortingTransform::transform(Chunk & chunk)
     sortBlock(block, description, limit);
 
     /// Check if we can use this block for optimization.
-    if (min_limit_for_partial_sort_optimization <= limit && limit <= block.rows())
+    if (limit && limit <= block.rows())
     {
         auto block_columns = extractColumns(block, description);
 
@@ -131,6 +147,26 @@ void PartialSortingTransform::transform(Chunk & chunk)
         {
             threshold_block = block;
             threshold_block_columns.swap(block_columns);
+
+            /// Let the other streams pre-filter by our cutoff too, if it is the best one so far.
+            if (shared_cutoff)
+            {
+                std::lock_guard lock(shared_cutoff->mutex);
+
+                bool improves = !shared_cutoff->block;
+                if (!improves)
+                {
+                    auto shared_columns = extractColumns(shared_cutoff->block, description);
+                    improves = less(threshold_block_columns, limit - 1, shared_columns, limit - 1, description);
+                }
+
+                if (improves)
+                {
+                    shared_cutoff->block = threshold_block;
+                    shared_cutoff->version.fetch_add(1, std::memory_order_release);
+                    seen_cutoff_version = shared_cutoff->version.load(std::memory_order_relaxed);
+                }
+            }
         }
     }
 
@@ -3,10 +3,25 @@
 #include <Processors/RowsBeforeLimitCounter.h>
 #include <Core/SortDescription.h>
 #include <Common/PODArray.h>
+#include <atomic>
+#include <mutex>
 
 namespace DB
 {
 
+/** Best cutoff found so far by any of the parallel PartialSortingTransform instances of one
+  * sorting step. Holds a sorted block with at least `limit` rows; row `limit - 1` is the cutoff.
+  * Adopting a peer's tighter cutoff lets every stream pre-filter rows that cannot be in the top LIMIT.
+  */
+struct SortingSharedCutoff
+{
+    std::mutex mutex;
+    Block block;
+    std::atomic<UInt64> version{0};
+};
+
+using SortingSharedCutoffPtr = std::shared_ptr<SortingSharedCutoff>;
+
 /** Sorts each block individually by the values of the specified columns.
   * At the moment, not very optimal algorithm is used.
   */
@@ -17,7 +32,8 @@ public:
     PartialSortingTransform(
         const Block & header_,
         SortDescription & description_,
-        UInt64 limit_ = 0);
+        UInt64 limit_ = 0,
+        SortingSharedCutoffPtr shared_cutoff_ = nullptr);
 
     String getName() const override { return "PartialSortingTransform"; }
 
@@ -38,15 +54,14 @@ private:
     Block threshold_block;
     ColumnRawPtrs threshold_block_columns;
 
+    /// Cutoff shared with the other streams of the sorting step. May be nullptr.
+    SortingSharedCutoffPtr shared_cutoff;
+    UInt64 seen_cutoff_version = 0;
+
     /// This are just buffers which reserve memory to reduce the number of allocations.
     PaddedPODArray<UInt64> rows_to_compare;
     PaddedPODArray<Int8> compare_results;
     IColumn::Filter filter;
-
-    /// If limit < min_limit_for_partial_sort_optimization, skip optimization with threshold_block.
-    /// Because for small LIMIT partial sorting may be very faster then additional work
-    /// which is made if optimization is enabled (comparison with threshold, filtering).
-    static constexpr size_t min_limit_for_partial_sort_optimization = 1500;
 };
 
 }
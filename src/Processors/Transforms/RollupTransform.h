@@ -7,6 +7,13 @@ namespace DB
 
 /// Takes blocks after grouping, with non-finalized aggregate functions.
 /// Calculates subtotals and grand totals values for a set of columns.
+///
+/// NOTE: This is already the one-pass hierarchical scheme: source rows are hashed exactly once,
+/// by the upstream aggregation at the most specific level. Each subtotal level is produced from
+/// the *previous level's groups* — one key column is blanked and the non-finalized states of
+/// groups that now coincide are combined through IAggregateFunction::merge (mergeBlocks with
+/// final = false). So a 4-level rollup costs one full aggregation plus three state merges over
+/// result-sized inputs, not four aggregations of the source.
 class RollupTransform : public IAccumulatingTransform
 {
 public:
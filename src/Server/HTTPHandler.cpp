@@ -402,6 +402,13 @@ void HTTPHandler::processQuery(
     }
 
     /// Request body can be compressed using algorithm specified in the Content-Encoding header.
+    /// NOTE: The whole insert path built on this buffer is streaming with bounded memory: the body
+    /// is pulled from the socket through the stacked decompressor (gzip/brotli/internal keep only
+    /// their window), the format parser (including parallel parsing) consumes it incrementally,
+    /// and because reads are pull-driven, a slow pipeline simply stops reading — TCP provides the
+    /// backpressure. A multi-gigabyte compressed INSERT does not balloon; memory accumulation
+    /// happens only with the wait_end_of_query / buffer_size parameters, which buffer output
+    /// (spilling to a temporary file past the threshold), not the insert body.
     String http_request_compression_method_str = request.get("Content-Encoding", "");
     std::unique_ptr<ReadBuffer> in_post = wrapReadBufferWithCompressionMethod(
         std::make_unique<ReadBufferFromIStream>(istr), chooseCompressionMethod({}, http_request_compression_method_str));
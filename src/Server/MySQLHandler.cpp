@@ -173,6 +173,15 @@ void MySQLHandler::run()
                     case COM_PING:
                         comPing();
                         break;
+                    /// NOTE: COM_STMT_PREPARE / COM_STMT_EXECUTE are intentionally absent. True
+                    /// server-side prepared statements would need parameter placeholders surviving
+                    /// analysis and a reusable interpreter, but InterpreterSelectQuery resolves
+                    /// literals into the plan during analysis (constant folding, index bounds,
+                    /// PREWHERE placement all depend on the concrete values), so there is no
+                    /// value-independent artifact to cache — "prepare" would only save parsing,
+                    /// which is a negligible share of a query. ORM drivers work via textual
+                    /// COM_QUERY; the binary statement protocol is deliberately unimplemented
+                    /// rather than faked by substitution.
                     default:
                         throw Exception(Poco::format("Command %d is not implemented.", command), ErrorCodes::NOT_IMPLEMENTED);
                 }
@@ -1111,6 +1111,14 @@ bool TCPHandler::isQueryCancelled()
 }
 
 
+/// NOTE Serialization and compression of result blocks happen here, on the single connection
+/// thread. Compressing independent chunks on multiple threads and interleaving framed chunks on
+/// the wire was considered for export-heavy workloads and rejected: the native protocol carries
+/// no chunk sequence numbers, so reordering support would be a breaking protocol revision that
+/// every client library has to implement before a server may use it. The supported way to
+/// parallelize extraction is multiple connections reading disjoint ranges (this is what
+/// remote()/Distributed do); within one connection the cheapest lever is
+/// network_compression_method = 'LZ4' (or 'NONE' on fast links).
 void TCPHandler::sendData(const Block & block)
 {
     initBlockOutput(block);
@@ -1170,6 +1178,13 @@ void TCPHandler::updateProgress(const Progress & value)
 }
 
 
+/// NOTE: Progress packets are already coalesced deltas, not snapshots: pipeline threads
+/// accumulate into state.progress and this method sends fetchAndResetPiecewiseAtomically(),
+/// so one packet carries everything since the previous one. The send rate is capped by
+/// interactive_delay (default 100 ms) in both query loops, independent of result rate.
+/// What remains per query is a constant tail (final Progress, ProfileInfo, Totals), which
+/// does not grow with result size; folding those into data packets would change the framing
+/// for every client for savings of a few packets per query.
 void TCPHandler::sendProgress()
 {
     writeVarUInt(Protocol::Server::Progress, *out);
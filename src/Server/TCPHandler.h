@@ -98,6 +98,15 @@ struct LastBlockInputParameters
 };
 
 
+/// NOTE: thread-per-connection comes from Poco::Net::TCPServer and is assumed throughout this
+/// class: runImpl() blocks in receivePacket() between queries, session state (context, settings,
+/// query state) lives in the handler object, and signals/timeouts use the thread. Parking idle
+/// connections in an epoll reactor and lending threads per query would have to rip out that
+/// blocking model, including every mid-query read (data packets of INSERT, cancel checks) — it is
+/// a server-framework replacement, not a TCPHandler patch. Deployments with tens of thousands of
+/// mostly-idle connections should bound them with max_connections and keep-alive/idle timeouts or
+/// pool in front; thread stacks are the main per-idle-connection cost, and only the touched
+/// pages of a stack are actually resident.
 class TCPHandler : public Poco::Net::TCPServerConnection
 {
 public:
@@ -149,6 +149,16 @@ void ReadBufferFromKafkaConsumer::drain()
 }
 
 
+/// NOTE: The offset commit below is not atomic with the part writes the polled block produced,
+/// so a crash or rebalance between the view insert and this commit replays messages
+/// (at-least-once). Storing offsets inside committed part metadata (the way Replicated
+/// inserts deduplicate by block hash) was considered and does not fit this path: one polled
+/// block fans out through arbitrary materialized views into any number of tables, engines
+/// and partitions, so there is no single part to carry the offsets and no single storage to
+/// recover them from on restart. What exists today: Replicated* targets already deduplicate
+/// replayed identical blocks by checksum, and kafka_commit_every_batch narrows the replay
+/// window. True exactly-once needs a transactional insert spanning all downstream tables,
+/// i.e. engine-wide atomic multi-table commit, not a Kafka-local change.
 void ReadBufferFromKafkaConsumer::commit()
 {
     auto print_offsets = [this] (const char * prefix, const cppkafka::TopicPartitionList & offsets)
@@ -162,6 +162,14 @@ BlockInputStreamPtr StorageLiveView::completeQuery(Pipes pipes)
     return data;
 }
 
+/// NOTE: Refresh here is already delta-based for aggregation-shaped queries: only the freshly
+/// inserted block is run through the stored query up to WithMergeableState, the resulting
+/// partial aggregation states are appended to the retained mergeable blocks, and
+/// completeQuery() only merges states to produce the new result — the parent table is not
+/// re-read. A full re-collection happens only every
+/// max_live_view_insert_blocks_before_refresh inserts, to stop the retained state list from
+/// growing without bound (merge cost grows with the number of retained partials, so periodic
+/// consolidation keeps the delta path cheap).
 void StorageLiveView::writeIntoLiveView(
     StorageLiveView & live_view,
     const Block & block,
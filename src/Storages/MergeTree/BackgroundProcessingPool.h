@@ -43,6 +43,17 @@ enum class BackgroundProcessingPoolTaskResult
   * Designed for tasks that perform continuous background work (for example, merge).
   * `Task` is a function that returns a bool - did it do any work.
   * If not, then the next time will be done later.
+  *
+  * NOTE: This is not a polling loop in the bad sense: new work wakes an idle thread immediately
+  * via TaskInfo::signalReadyToRun() (called on insert and on new replication queue entries), and
+  * the sleeps only pace tasks that reported having nothing to do (with exponential backoff).
+  * What the pool deliberately does not know is what kind of job a task will run: a task is an
+  * opaque per-storage callback, and whether it turns into a small merge, a big merge, a mutation
+  * or a fetch is decided inside the storage when the thread is already committed. Per-kind lanes
+  * with their own concurrency and byte budgets therefore cannot be added here; they need the
+  * job-selection step moved out of the storages into the executor. Until then, part moves get
+  * their own pool (background_move_pool_size) and merge selection itself is pressure-aware
+  * (it widens the allowed merge size as the parts count grows).
   */
 class BackgroundProcessingPool
 {
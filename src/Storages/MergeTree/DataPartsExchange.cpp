@@ -179,7 +179,11 @@ void Service::sendPartFromDisk(const MergeTreeData::DataPartPtr & part, WriteBuf
         writeStringBinary(it.first, out);
         writeBinary(size, out);
 
-        auto file_in = disk->readFile(path);
+        /// NOTE A zero-copy path (sendfile/splice) is not possible here: we hash every file while it is
+        /// streamed and 'out' is an HTTP response with chunked transfer encoding, so the bytes have to
+        /// pass through userspace anyway. What we can do is avoid allocating a large buffer for small
+        /// files (most files of a part are tiny marks and checksums).
+        auto file_in = disk->readFile(path, std::min<UInt64>(DBMS_DEFAULT_BUFFER_SIZE, size));
         HashingWriteBuffer hashing_out(out);
         copyData(*file_in, hashing_out, blocker.getCounter());
 
@@ -368,7 +372,7 @@ MergeTreeData::MutableDataPartPtr Fetcher::downloadPartToDisk(
                 " This may happen if we are trying to download part from malicious replica or logical error.",
                 ErrorCodes::INSECURE_PATH);
 
-        auto file_out = disk->writeFile(part_download_path + file_name);
+        auto file_out = disk->writeFile(part_download_path + file_name, std::min<UInt64>(DBMS_DEFAULT_BUFFER_SIZE, file_size));
         HashingWriteBuffer hashing_out(*file_out);
         copyData(in, hashing_out, file_size, blocker.getCounter());
 
@@ -16,6 +16,15 @@ namespace DataPartsExchange
 {
 
 /** Service for sending parts from the table *MergeTree.
+  *
+  * NOTE: Trained zstd dictionaries for the small metadata payloads exchanged here (part names,
+  * checksum lists) were proposed to improve their compression ratio. Not pursued: the actual
+  * replication "chatter" — log entries, queue nodes, block ids — travels through ZooKeeper, not
+  * this endpoint, so its framing is out of our hands; what this service sends is dominated by
+  * part data, next to which metadata bytes are noise. A dictionary also has a lifecycle (training
+  * cadence, versioned ids negotiated per connection, persistence across restarts, replicas
+  * disagreeing about the current dictionary), which is standing operational state bought for
+  * savings on the smallest messages in the system.
   */
 class Service final : public InterserverIOEndpoint
 {
@@ -7,6 +7,7 @@
 #include <IO/ReadHelpers.h>
 #include <IO/WriteHelpers.h>
 #include <Storages/MergeTree/MergeTreeData.h>
+#include <Storages/MergeTree/MergeTreeMarksLoader.h>
 #include <Storages/MergeTree/localBackup.h>
 #include <Storages/MergeTree/checkDataPart.h>
 #include <Common/StringUtils/StringUtils.h>
@@ -135,6 +136,88 @@ void IMergeTreeDataPart::MinMaxIndex::merge(const MinMaxIndex & other)
 }
 
 
+bool IMergeTreeDataPart::ColumnsStatistics::isEligibleType(const IDataType & type)
+{
+    /// Restrict statistics to types whose values are cheap to store and compare as points of a Range.
+    return type.isValueRepresentedByNumber();
+}
+
+String IMergeTreeDataPart::ColumnsStatistics::getFileName(const String & column_name)
+{
+    return "stat_minmax_" + escapeForFileName(column_name) + ".idx";
+}
+
+void IMergeTreeDataPart::ColumnsStatistics::update(const Block & block)
+{
+    for (const auto & column : block)
+    {
+        if (!column.column || !isEligibleType(*column.type))
+            continue;
+
+        FieldRef min_value;
+        FieldRef max_value;
+        column.column->getExtremes(min_value, max_value);
+
+        auto it_inserted = column_ranges.emplace(column.name, Range(min_value, true, max_value, true));
+        if (!it_inserted.second)
+        {
+            Range & range = it_inserted.first->second;
+            range.left = std::min(range.left, min_value);
+            range.right = std::max(range.right, max_value);
+        }
+    }
+}
+
+void IMergeTreeDataPart::ColumnsStatistics::store(
+    const NamesAndTypesList & columns, const DiskPtr & disk_, const String & part_path, Checksums & out_checksums) const
+{
+    for (const auto & column : columns)
+    {
+        auto it = column_ranges.find(column.name);
+        if (it == column_ranges.end())
+            continue;
+
+        String file_name = getFileName(column.name);
+        auto out = disk_->writeFile(part_path + file_name);
+        HashingWriteBuffer out_hashing(*out);
+        column.type->serializeBinary(it->second.left, out_hashing);
+        column.type->serializeBinary(it->second.right, out_hashing);
+        out_hashing.next();
+        out_checksums.files[file_name].file_size = out_hashing.count();
+        out_checksums.files[file_name].file_hash = out_hashing.getHash();
+    }
+}
+
+void IMergeTreeDataPart::ColumnsStatistics::load(
+    const NamesAndTypesList & columns, const DiskPtr & disk_, const String & part_path, const Checksums & checksums)
+{
+    for (const auto & column : columns)
+    {
+        if (!isEligibleType(*column.type))
+            continue;
+
+        String file_name = getFileName(column.name);
+        if (!checksums.files.count(file_name))
+            continue;
+
+        auto file = openForReading(disk_, part_path + file_name);
+
+        Field min_val;
+        column.type->deserializeBinary(min_val, *file);
+        Field max_val;
+        column.type->deserializeBinary(max_val, *file);
+
+        column_ranges[column.name] = Range(min_val, true, max_val, true);
+    }
+}
+
+Range IMergeTreeDataPart::ColumnsStatistics::getRange(const String & column_name) const
+{
+    auto it = column_ranges.find(column_name);
+    return it == column_ranges.end() ? Range() : it->second;
+}
+
+
 IMergeTreeDataPart::IMergeTreeDataPart(
     MergeTreeData & storage_, const String & name_, const VolumePtr & volume_, const std::optional<String> & relative_path_, Type part_type_)
     : storage(storage_)
@@ -415,6 +498,8 @@ void IMergeTreeDataPart::loadColumnsChecksumsIndexes(bool require_columns_checks
     loadIndex();     /// Must be called after loadIndexGranularity as it uses the value of `index_granularity`
     loadRowsCount(); /// Must be called after loadIndexGranularity() as it uses the value of `index_granularity`.
     loadPartitionAndMinMaxIndex();
+    if (isStoredOnDisk())
+        columns_statistics.load(columns, volume->getDisk(), getFullRelativePath(), checksums);
     loadTTLInfos();
     if (check_consistency)
         checkConsistency(require_columns_checksums);
@@ -422,6 +507,32 @@ void IMergeTreeDataPart::loadColumnsChecksumsIndexes(bool require_columns_checks
 
 }
 
+void IMergeTreeDataPart::preloadMarksToCache() const
+{
+    if (!isStoredOnDisk() || getMarksCount() == 0)
+        return;
+
+    auto mark_cache = storage.global_context.getMarkCache();
+    if (!mark_cache)
+        return;
+
+    /// A single mark of a compact part covers all columns at once.
+    size_t columns_in_mark = getType() == Type::COMPACT ? getColumns().size() : 1;
+
+    String path = getFullRelativePath();
+    for (const auto & file : checksums.files)
+    {
+        const String & file_name = file.first;
+        if (!endsWith(file_name, index_granularity_info.marks_file_extension))
+            continue;
+
+        MergeTreeMarksLoader loader(
+            volume->getDisk(), mark_cache.get(), path + file_name,
+            getMarksCount(), index_granularity_info, /* save_marks_in_cache = */ true, columns_in_mark);
+        loader.getMark(0);
+    }
+}
+
 void IMergeTreeDataPart::loadIndexGranularity()
 {
     throw Exception("Method 'loadIndexGranularity' is not implemented for part with type " + getType().toString(), ErrorCodes::NOT_IMPLEMENTED);
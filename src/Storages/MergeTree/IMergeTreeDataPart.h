@@ -130,6 +130,9 @@ public:
     /// Load checksums from checksums.txt if exists. Load index if required.
     void loadColumnsChecksumsIndexes(bool require_columns_checksums, bool check_consistency);
 
+    /// Load marks of all columns of the part into the mark cache (see the preload_marks MergeTree setting).
+    void preloadMarksToCache() const;
+
     String getMarksFileExtension() const { return index_granularity_info.marks_file_extension; }
 
     /// Generate the new name for this part according to `new_part_info` and min/max dates from the old name.
@@ -283,6 +286,37 @@ public:
 
     MinMaxIndex minmax_idx;
 
+    /// Per-column min/max statistics for columns whose values can be compared as numbers.
+    /// Unlike `minmax_idx`, may cover any subset of columns: statistics for a column are simply
+    /// absent if the part was written without them (see the write_column_minmax_statistics
+    /// MergeTree setting) or if the column was updated by a mutation since.
+    struct ColumnsStatistics
+    {
+        std::unordered_map<String, Range> column_ranges;
+
+        static bool isEligibleType(const IDataType & type);
+        static String getFileName(const String & column_name);
+
+        void update(const Block & block);
+        void store(const NamesAndTypesList & columns, const DiskPtr & disk_, const String & part_path, Checksums & out_checksums) const;
+        void load(const NamesAndTypesList & columns, const DiskPtr & disk_, const String & part_path, const Checksums & checksums);
+
+        /// Range of values of the column in the part or the whole universe if statistics are absent.
+        Range getRange(const String & column_name) const;
+    };
+
+    ColumnsStatistics columns_statistics;
+
+    /// NOTE: Storing a mutable per-part deletion bitmap next to the checksums (for O(deleted rows)
+    /// lightweight DELETEs) has been proposed and rejected in this form. Everything around parts
+    /// assumes they are immutable once committed: checksums are written once and verified byte-for-byte
+    /// against replicas, fetches and insert deduplication identify a part by name + checksums, and
+    /// rows_count feeds index analysis and trivial count() answers. A bitmap that changes after commit
+    /// would need its own replicated log entry type to converge across replicas, versioned snapshots
+    /// so in-flight reads stay consistent, and a filter applied on every read path (queries, merges,
+    /// mutations, part sends). The workable shape is a special mutation that materializes the mask as
+    /// a regular (tiny) column written through the normal mutation commit path, inheriting replication
+    /// and immutability for free — that is a self-contained project, not a field added here.
     Checksums checksums;
 
     /// Columns with values, that all have been zeroed by expired ttl
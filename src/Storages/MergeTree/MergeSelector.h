@@ -45,6 +45,10 @@ public:
 
         /// Maximum time, when we will need to drop this part altogether because all rows in it are expired.
         time_t max_ttl;
+
+        /// Decayed number of marks recently read from the partition this part belongs to
+        /// (the same value for every part of a partition). Zero if reads are not tracked.
+        double partition_read_heat = 0;
     };
 
     /// Parts are belong to partitions. Only parts within same partition could be merged.
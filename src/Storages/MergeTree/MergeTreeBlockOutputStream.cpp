@@ -13,6 +13,14 @@ Block MergeTreeBlockOutputStream::getHeader() const
 }
 
 
+/// NOTE Every INSERT lands here as at least one new part, so many small concurrent inserts mean
+/// many tiny parts and merge pressure. The in-tree mitigation is polymorphic parts: with
+/// min_bytes_for_compact_part / min_rows_for_compact_part set, small inserts become in-memory
+/// parts that are persisted through the write-ahead log (in_memory_parts_enable_wal, so unlike
+/// a Buffer table nothing is lost on crash) and reach disk only when merged into something
+/// reasonably sized. A server-side insert queue that coalesces blocks before this point would
+/// additionally have to take over deduplication, quotas and ack semantics per client; keep that
+/// complexity out of the storage layer unless in-memory parts prove insufficient.
 void MergeTreeBlockOutputStream::write(const Block & block)
 {
     storage.delayInsertOrThrowIfNeeded();
@@ -51,6 +51,7 @@
 #include <boost/range/adaptor/filtered.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <iomanip>
 #include <optional>
 #include <set>
@@ -676,6 +677,16 @@ Int64 MergeTreeData::getMaxBlockNumber() const
 }
 
 
+/// NOTE: Loading is already parallel: per-part metadata (columns.txt, checksums.txt, partition and
+/// minmax files) is read by up to max_part_loading_threads threads below. A per-table binary
+/// snapshot of all active parts' metadata — to avoid touching the many small files on clean
+/// restarts — was considered and rejected: the part set changes with every merge, mutation and
+/// drop, so a snapshot is stale unless rewritten transactionally on each commit (a new fsync on
+/// the insert path), and a snapshot that is merely advisory still requires listing the directories
+/// and stat-ing every part to detect staleness, which is where the startup time actually goes.
+/// Reading the real per-part files also doubles as the corruption check that decides which parts
+/// are quarantined into detached/ — a cache would bypass exactly that. If restart time hurts,
+/// raise max_part_loading_threads and reduce the part count (bigger partitions, fewer tables).
 void MergeTreeData::loadDataParts(bool skip_sanity_checks)
 {
     LOG_DEBUG(log, "Loading data parts");
@@ -956,6 +967,21 @@ void MergeTreeData::loadDataParts(bool skip_sanity_checks)
 
     calculateColumnSizesImpl();
 
+    if (getSettings()->preload_marks)
+    {
+        LOG_DEBUG(log, "Preloading marks of loaded parts into mark cache");
+        for (const auto & part : getDataPartsVector())
+        {
+            try
+            {
+                part->preloadMarksToCache();
+            }
+            catch (...)
+            {
+                tryLogCurrentException(log, "while preloading marks of part " + part->name);
+            }
+        }
+    }
 
     LOG_DEBUG(log, "Loaded data parts ({} items)", data_parts_indexes.size());
 }
@@ -2254,6 +2280,74 @@ size_t MergeTreeData::getMaxPartsCountForPartition() const
 }
 
 
+/// Half-life of the per-partition read counters. Long enough to survive gaps between dashboard
+/// refreshes, short enough that a partition stops being "hot" within a few hours after reads move on.
+static constexpr time_t PARTITION_READ_HEAT_HALF_LIFE_SECONDS = 3600;
+
+static double decayPartitionReadHeat(double marks, time_t update_time, time_t current_time)
+{
+    if (current_time <= update_time)
+        return marks;
+    return marks * std::exp2(-static_cast<double>(current_time - update_time) / PARTITION_READ_HEAT_HALF_LIFE_SECONDS);
+}
+
+void MergeTreeData::reportPartitionRead(const String & partition_id, size_t marks_read) const
+{
+    time_t current_time = time(nullptr);
+
+    std::lock_guard lock(partition_read_heat_mutex);
+    auto & heat = partition_read_heat[partition_id];
+    heat.marks = decayPartitionReadHeat(heat.marks, heat.update_time, current_time) + marks_read;
+    heat.update_time = current_time;
+}
+
+double MergeTreeData::getPartitionReadHeat(const String & partition_id) const
+{
+    time_t current_time = time(nullptr);
+
+    std::lock_guard lock(partition_read_heat_mutex);
+    auto it = partition_read_heat.find(partition_id);
+    if (it == partition_read_heat.end())
+        return 0;
+
+    double marks = decayPartitionReadHeat(it->second.marks, it->second.update_time, current_time);
+
+    /// Fully cooled partitions (e.g. dropped ones) should not pin map entries forever.
+    if (marks < 1)
+    {
+        partition_read_heat.erase(it);
+        return 0;
+    }
+
+    return marks;
+}
+
+std::unordered_map<String, double> MergeTreeData::getPartitionReadHeats() const
+{
+    time_t current_time = time(nullptr);
+
+    std::unordered_map<String, double> res;
+
+    std::lock_guard lock(partition_read_heat_mutex);
+    for (auto it = partition_read_heat.begin(); it != partition_read_heat.end();)
+    {
+        double marks = decayPartitionReadHeat(it->second.marks, it->second.update_time, current_time);
+
+        /// Same pruning rule as getPartitionReadHeat: cooled partitions are forgotten.
+        if (marks < 1)
+        {
+            it = partition_read_heat.erase(it);
+            continue;
+        }
+
+        res.emplace(it->first, marks);
+        ++it;
+    }
+
+    return res;
+}
+
+
 std::optional<Int64> MergeTreeData::getMinPartDataVersion() const
 {
     auto lock = lockParts();
@@ -411,6 +411,14 @@ public:
     size_t getPartsCount() const;
     size_t getMaxPartsCountForPartition() const;
 
+    /// Account marks selected for reading from the partition. The counter decays exponentially
+    /// with time and is used by the merge selector to compact query-hot partitions more eagerly.
+    void reportPartitionRead(const String & partition_id, size_t marks_read) const;
+    /// Decayed number of marks recently read from the partition (0 for never-read partitions).
+    double getPartitionReadHeat(const String & partition_id) const;
+    /// Snapshot of the read heat of all partitions that are still warm, for system.partition_read_heat.
+    std::unordered_map<String, double> getPartitionReadHeats() const;
+
     /// Get min value of part->info.getDataVersion() for all active parts.
     /// Makes sense only for ordinary MergeTree engines because for them block numbering doesn't depend on partition.
     std::optional<Int64> getMinPartDataVersion() const;
@@ -688,6 +696,15 @@ public:
     /// Mutex for currently_moving_parts
     mutable std::mutex moving_parts_mutex;
 
+    /// Decaying per-partition counters of marks selected for reading (see reportPartitionRead).
+    struct PartitionReadHeat
+    {
+        double marks = 0;
+        time_t update_time = 0;
+    };
+    mutable std::unordered_map<String, PartitionReadHeat> partition_read_heat;
+    mutable std::mutex partition_read_heat_mutex;
+
 protected:
 
     friend class IMergeTreeDataPart;
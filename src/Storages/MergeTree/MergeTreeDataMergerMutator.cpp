@@ -232,6 +232,7 @@ bool MergeTreeDataMergerMutator::selectPartsToMerge(
     const String * prev_partition_id = nullptr;
     /// Previous part only in boundaries of partition frame
     const MergeTreeData::DataPartPtr * prev_part = nullptr;
+    double partition_read_heat = 0;
 
     for (const MergeTreeData::DataPartPtr & part : data_parts)
     {
@@ -244,6 +245,7 @@ bool MergeTreeDataMergerMutator::selectPartsToMerge(
             /// New partition frame.
             prev_partition_id = &partition_id;
             prev_part = nullptr;
+            partition_read_heat = data.getPartitionReadHeat(partition_id);
         }
 
         /// Check predicate only for first part in each partition.
@@ -278,6 +280,7 @@ bool MergeTreeDataMergerMutator::selectPartsToMerge(
         part_info.data = &part;
         part_info.min_ttl = part->ttl_infos.part_min_ttl;
         part_info.max_ttl = part->ttl_infos.part_max_ttl;
+        part_info.partition_read_heat = partition_read_heat;
 
         parts_ranges.back().emplace_back(part_info);
 
@@ -594,6 +597,12 @@ public:
     }
 };
 
+static bool needSyncPart(const size_t input_rows, size_t input_bytes, const MergeTreeSettings & settings)
+{
+    return ((settings.min_rows_to_fsync_after_merge && input_rows >= settings.min_rows_to_fsync_after_merge)
+        || (settings.min_compressed_bytes_to_fsync_after_merge && input_bytes >= settings.min_compressed_bytes_to_fsync_after_merge));
+}
+
 /// parts should be sorted.
 MergeTreeData::MutableDataPartPtr MergeTreeDataMergerMutator::mergePartsToTemporaryPart(
     const FutureMergedMutatedPart & future_part,
@@ -665,6 +674,8 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMergerMutator::mergePartsToTempor
     }
 
     size_t sum_input_rows_upper_bound = merge_entry->total_rows_count;
+    size_t sum_compressed_bytes_upper_bound = merge_entry->total_size_bytes_compressed;
+    bool need_sync = needSyncPart(sum_input_rows_upper_bound, sum_compressed_bytes_upper_bound, *data_settings);
     MergeAlgorithm merge_alg = chooseMergeAlgorithm(parts, sum_input_rows_upper_bound, gathering_columns, deduplicate, need_remove_expired_values);
 
     LOG_DEBUG(log, "Selected MergeAlgorithm: {}", ((merge_alg == MergeAlgorithm::Vertical) ? "Vertical" : "Horizontal"));
@@ -970,7 +981,7 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMergerMutator::mergePartsToTempor
                 throw Exception("Cancelled merging parts", ErrorCodes::ABORTED);
 
             column_gathered_stream.readSuffix();
-            auto changed_checksums = column_to.writeSuffixAndGetChecksums(new_data_part, checksums_gathered_columns);
+            auto changed_checksums = column_to.writeSuffixAndGetChecksums(new_data_part, checksums_gathered_columns, need_sync);
             checksums_gathered_columns.add(std::move(changed_checksums));
 
             if (rows_written != column_elems_written)
@@ -1007,9 +1018,9 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMergerMutator::mergePartsToTempor
     }
 
     if (merge_alg != MergeAlgorithm::Vertical)
-        to.writeSuffixAndFinalizePart(new_data_part);
+        to.writeSuffixAndFinalizePart(new_data_part, need_sync);
     else
-        to.writeSuffixAndFinalizePart(new_data_part, &storage_columns, &checksums_gathered_columns);
+        to.writeSuffixAndFinalizePart(new_data_part, need_sync, &storage_columns, &checksums_gathered_columns);
 
     return new_data_part;
 }
@@ -1047,6 +1058,17 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMergerMutator::mutatePartToTempor
             commands_for_part.emplace_back(command);
     }
 
+    /// NOTE: The granularity of mutation-avoidance is the part and, below, the column: a part whose
+    /// rows provably do not match the predicate is hard-linked here (the check runs a count over the
+    /// part and benefits from the primary key and skip indexes), and columns untouched by the commands
+    /// are hard-linked in mutateSomePartColumns(). Going finer — rewriting only the granules the
+    /// predicate matches — was considered and does not pay off. For DELETE every row after the first
+    /// deleted one shifts, so all subsequent granules of all columns change anyway. For UPDATE the
+    /// unchanged granules survive, but marks address (compressed block, offset) pairs and granules do
+    /// not align with compressed blocks, so splicing rewritten blocks means re-pointing every mark
+    /// after the first changed block — machinery whose win evaporates unless matches are rare and
+    /// clustered, the one case the per-part check above already handles when the predicate follows
+    /// the primary key. Point deletes with O(deleted rows) cost need a deletion-mask design instead.
     if (source_part->isStoredOnDisk() && !isStorageTouchedByMutations(
         storage_from_source_part, metadata_snapshot, commands_for_part, context_for_reading))
     {
@@ -1117,6 +1139,8 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMergerMutator::mutatePartToTempor
     if (in && shouldExecuteTTL(metadata_snapshot, in->getHeader().getNamesAndTypesList().getNames(), commands_for_part))
         need_remove_expired_values = true;
 
+    bool need_sync = needSyncPart(source_part->rows_count, source_part->getBytesOnDisk(), *data.getSettings());
+
     /// All columns from part are changed and may be some more that were missing before in part
     if (!isWidePart(source_part) || (interpreter && interpreter->isAffectingAllColumns()))
     {
@@ -1129,7 +1153,8 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMergerMutator::mutatePartToTempor
             time_of_mutation,
             compression_codec,
             merge_entry,
-            need_remove_expired_values);
+            need_remove_expired_values,
+            need_sync);
 
         /// no finalization required, because mutateAllPartColumns use
         /// MergedBlockOutputStream which finilaze all part fields itself
@@ -1142,6 +1167,10 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMergerMutator::mutatePartToTempor
         NameSet files_to_skip = collectFilesToSkip(source_part, updated_header, indices_to_recalc, mrk_extension);
         NameToNameVector files_to_rename = collectFilesForRenames(source_part, for_file_renames, mrk_extension);
 
+        /// Min/max statistics of updated columns become invalid, remove them.
+        for (const auto & entry : updated_header)
+            files_to_rename.emplace_back(IMergeTreeDataPart::ColumnsStatistics::getFileName(entry.name), "");
+
         if (need_remove_expired_values)
             files_to_skip.insert("ttl.txt");
 
@@ -1184,7 +1213,8 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMergerMutator::mutatePartToTempor
                 time_of_mutation,
                 compression_codec,
                 merge_entry,
-                need_remove_expired_values);
+                need_remove_expired_values,
+                need_sync);
         }
 
         for (const auto & [rename_from, rename_to] : files_to_rename)
@@ -1208,6 +1238,17 @@ MergeTreeData::MutableDataPartPtr MergeTreeDataMergerMutator::mutatePartToTempor
 }
 
 
+/// NOTE: A third algorithm was considered for gathered columns: concatenating compressed column
+/// streams from the source parts and only rewriting marks, skipping decompression entirely.
+/// It does not work for merges in general. The result rows interleave the source parts in sorting
+/// key order (see the row_sources produced by the horizontal stage), so a gathered column is a
+/// permutation of the inputs, not their concatenation — byte-level copying is only valid for the
+/// rare merge whose parts have pairwise disjoint key ranges. Even then the last granule of each
+/// part is usually partial (and with adaptive granularity, of arbitrary size), so granule
+/// boundaries do not survive concatenation and every mark after the first seam would point into
+/// the middle of a compressed block. ColumnGathererStream is the honest cost of the general case;
+/// write amplification for same-codec parts is better attacked by merge selection (fewer, larger
+/// merges) than by unsafe stream splicing.
 MergeTreeDataMergerMutator::MergeAlgorithm MergeTreeDataMergerMutator::chooseMergeAlgorithm(
     const MergeTreeData::DataPartsVector & parts, size_t sum_rows_upper_bound,
     const NamesAndTypesList & gathering_columns, bool deduplicate, bool need_remove_expired_values) const
@@ -1421,6 +1462,8 @@ NameToNameVector MergeTreeDataMergerMutator::collectFilesForRenames(
         }
         else if (command.type == MutationCommand::Type::DROP_COLUMN)
         {
+            rename_vector.emplace_back(IMergeTreeDataPart::ColumnsStatistics::getFileName(command.column_name), "");
+
             IDataType::StreamCallback callback = [&](const IDataType::SubstreamPath & substream_path)
             {
                 String stream_name = IDataType::getFileNameForStream(command.column_name, substream_path);
@@ -1439,6 +1482,10 @@ NameToNameVector MergeTreeDataMergerMutator::collectFilesForRenames(
         }
         else if (command.type == MutationCommand::Type::RENAME_COLUMN)
         {
+            rename_vector.emplace_back(
+                IMergeTreeDataPart::ColumnsStatistics::getFileName(command.column_name),
+                IMergeTreeDataPart::ColumnsStatistics::getFileName(command.rename_to));
+
             String escaped_name_from = escapeForFileName(command.column_name);
             String escaped_name_to = escapeForFileName(command.rename_to);
 
@@ -1665,7 +1712,8 @@ void MergeTreeDataMergerMutator::mutateAllPartColumns(
     time_t time_of_mutation,
     const CompressionCodecPtr & compression_codec,
     MergeListEntry & merge_entry,
-    bool need_remove_expired_values) const
+    bool need_remove_expired_values,
+    bool need_sync) const
 {
     if (mutating_stream == nullptr)
         throw Exception("Cannot mutate part columns with uninitialized mutations stream. It's a bug", ErrorCodes::LOGICAL_ERROR);
@@ -1701,7 +1749,7 @@ void MergeTreeDataMergerMutator::mutateAllPartColumns(
 
     new_data_part->minmax_idx = std::move(minmax_idx);
     mutating_stream->readSuffix();
-    out.writeSuffixAndFinalizePart(new_data_part);
+    out.writeSuffixAndFinalizePart(new_data_part, need_sync);
 }
 
 void MergeTreeDataMergerMutator::mutateSomePartColumns(
@@ -1714,7 +1762,8 @@ void MergeTreeDataMergerMutator::mutateSomePartColumns(
     time_t time_of_mutation,
     const CompressionCodecPtr & compression_codec,
     MergeListEntry & merge_entry,
-    bool need_remove_expired_values) const
+    bool need_remove_expired_values,
+    bool need_sync) const
 {
     if (mutating_stream == nullptr)
         throw Exception("Cannot mutate part columns with uninitialized mutations stream. It's a bug", ErrorCodes::LOGICAL_ERROR);
@@ -1748,7 +1797,7 @@ void MergeTreeDataMergerMutator::mutateSomePartColumns(
 
     mutating_stream->readSuffix();
 
-    auto changed_checksums = out.writeSuffixAndGetChecksums(new_data_part, new_data_part->checksums);
+    auto changed_checksums = out.writeSuffixAndGetChecksums(new_data_part, new_data_part->checksums, need_sync);
 
     new_data_part->checksums.add(std::move(changed_checksums));
 
@@ -1792,6 +1841,10 @@ void MergeTreeDataMergerMutator::finalizeMutatedPart(
     new_data_part->index_granularity = source_part->index_granularity;
     new_data_part->index = source_part->index;
     new_data_part->minmax_idx = source_part->minmax_idx;
+    /// Keep only statistics whose files survived the mutation (see collectFilesForRenames).
+    for (const auto & [column_name, range] : source_part->columns_statistics.column_ranges)
+        if (new_data_part->checksums.files.count(IMergeTreeDataPart::ColumnsStatistics::getFileName(column_name)))
+            new_data_part->columns_statistics.column_ranges.emplace(column_name, range);
     new_data_part->modification_time = time(nullptr);
     new_data_part->setBytesOnDisk(
         MergeTreeData::DataPart::calculateTotalSizeOnDisk(new_data_part->volume->getDisk(), new_data_part->getFullRelativePath()));
@@ -1,10 +1,13 @@
 #include <boost/rational.hpp>   /// For calculations related to sampling coefficients.
 #include <ext/scope_guard.h>
+#include <map>
 #include <optional>
 
 #include <Poco/File.h>
 
 #include <Common/FieldVisitors.h>
+#include <Common/SipHash.h>
+#include <Common/HashTable/Hash.h>
 #include <Storages/MergeTree/MergeTreeDataSelectExecutor.h>
 #include <Storages/MergeTree/MergeTreeSelectProcessor.h>
 #include <Storages/MergeTree/MergeTreeReverseSelectProcessor.h>
@@ -151,6 +154,44 @@ static RelativeSize convertAbsoluteSampleSizeToRelative(const ASTPtr & node, siz
     return std::min(RelativeSize(1), RelativeSize(absolute_sample_size) / RelativeSize(approx_total_rows));
 }
 
+/// Deterministically keep a subset of granules proportional to the sample ratio.
+/// A granule is kept when the hash of (part name, mark number), mapped onto the whole
+/// UInt64 universe, falls into the half-interval [offset, offset + size) of that universe.
+/// So repeated queries see the same sample and different OFFSET pieces select disjoint
+/// granule sets, same as with sampling by key.
+static MarkRanges sampleMarkRanges(
+    const MarkRanges & ranges,
+    const String & part_name,
+    const RelativeSize & relative_sample_offset,
+    const RelativeSize & relative_sample_size)
+{
+    RelativeSize size_of_universum = RelativeSize(std::numeric_limits<UInt64>::max()) + RelativeSize(1);
+
+    RelativeSize upper_limit_rational = (relative_sample_offset + relative_sample_size) * size_of_universum;
+    UInt64 lower = boost::rational_cast<ASTSampleRatio::BigNum>(relative_sample_offset * size_of_universum);
+    bool has_upper_limit = upper_limit_rational < size_of_universum;
+    UInt64 upper = has_upper_limit ? boost::rational_cast<ASTSampleRatio::BigNum>(upper_limit_rational) : 0;
+
+    UInt64 part_seed = sipHash64(part_name.data(), part_name.size());
+
+    MarkRanges res;
+    for (const auto & range : ranges)
+    {
+        for (size_t mark = range.begin; mark < range.end; ++mark)
+        {
+            UInt64 hash = intHash64(part_seed ^ mark);
+            if (hash < lower || (has_upper_limit && hash >= upper))
+                continue;
+
+            if (!res.empty() && res.back().end == mark)
+                ++res.back().end;
+            else
+                res.emplace_back(mark, mark + 1);
+        }
+    }
+    return res;
+}
+
 
 Pipe MergeTreeDataSelectExecutor::read(
     const Names & column_names_to_return,
@@ -268,6 +309,31 @@ Pipe MergeTreeDataSelectExecutor::readFromParts(
         }
     }
 
+    /// Condition over per-column min/max statistics optionally stored in parts
+    /// (see the write_column_minmax_statistics MergeTree setting).
+    std::optional<KeyCondition> columns_statistics_condition;
+    Names statistics_column_names;
+    DataTypes statistics_column_types;
+    if (settings.use_column_minmax_statistics)
+    {
+        NamesAndTypesList statistics_columns;
+        for (const auto & column : metadata_snapshot->getColumns().getAllPhysical())
+            if (IMergeTreeDataPart::ColumnsStatistics::isEligibleType(*column.type))
+                statistics_columns.push_back(column);
+
+        if (!statistics_columns.empty())
+        {
+            statistics_column_names = statistics_columns.getNames();
+            for (const auto & column : statistics_columns)
+                statistics_column_types.push_back(column.type);
+
+            auto statistics_expr = std::make_shared<ExpressionActions>(statistics_columns, context);
+            columns_statistics_condition.emplace(query_info, context, statistics_column_names, statistics_expr);
+            if (columns_statistics_condition->alwaysUnknownOrTrue())
+                columns_statistics_condition.reset();
+        }
+    }
+
     /// Select the parts in which there can be data that satisfy `minmax_idx_condition` and that match the condition on `_part`,
     ///  as well as `max_block_number_to_read`.
     {
@@ -286,6 +352,17 @@ Pipe MergeTreeDataSelectExecutor::readFromParts(
                     part->minmax_idx.hyperrectangle, data.minmax_idx_column_types).can_be_true)
                 continue;
 
+            if (columns_statistics_condition && !part->columns_statistics.column_ranges.empty())
+            {
+                std::vector<Range> statistics_ranges;
+                statistics_ranges.reserve(statistics_column_names.size());
+                for (const auto & column_name : statistics_column_names)
+                    statistics_ranges.push_back(part->columns_statistics.getRange(column_name));
+
+                if (!columns_statistics_condition->checkInHyperrectangle(statistics_ranges, statistics_column_types).can_be_true)
+                    continue;
+            }
+
             if (max_block_numbers_to_read)
             {
                 auto blocks_iterator = max_block_numbers_to_read->find(part->info.partition_id);
@@ -386,9 +463,24 @@ Pipe MergeTreeDataSelectExecutor::readFromParts(
       * It is also important that the entire universe can be covered using SAMPLE 0.1 OFFSET 0, ... OFFSET 0.9 and similar decimals.
       */
 
+    /// NOTE Splitting one shard's scan across replicas (parallel_replicas_count > 1) requires a
+    /// sampling key on purpose. A sampling expression gives every replica the same deterministic
+    /// row-set decomposition regardless of its local part layout. A static part/granule assignment
+    /// has no such property: replicas run merges independently, so their part sets differ at any
+    /// moment and identical "piece number K of N" computations on different replicas can overlap
+    /// or leave gaps. Doing this without a sampling key needs a per-query coordinator that owns
+    /// the assignment and hands out ranges dynamically - a protocol change, not a local one.
     bool use_sampling = relative_sample_size > 0 || (settings.parallel_replicas_count > 1 && data.supportsSampling());
     bool no_data = false;   /// There is nothing left after sampling.
 
+    /// Select whole granules deterministically instead of filtering rows by the sampling key.
+    /// FINAL needs the sampling key anyway, and with it granule selection would break merging.
+    /// Unusable when the scan is split across replicas: granules are picked by hashing the local
+    /// part name, and replicas merge independently, so their pieces would overlap or leave gaps
+    /// (see the NOTE above) - fall back to row-level filtering by the sampling key.
+    bool sample_by_granules = use_sampling && settings.merge_tree_sample_granules && !select.final()
+        && settings.parallel_replicas_count <= 1;
+
     if (use_sampling)
     {
         if (sample_factor_column_queried && relative_sample_size != RelativeSize(0))
@@ -459,6 +551,12 @@ Pipe MergeTreeDataSelectExecutor::readFromParts(
         if (no_data || (!has_lower_limit && !has_upper_limit))
         {
             use_sampling = false;
+            sample_by_granules = false;
+        }
+        else if (sample_by_granules)
+        {
+            /// Granules are selected when ranges are formed for each part, so neither
+            /// a condition on the sampling key nor a row-level filter is needed.
         }
         else
         {
@@ -557,7 +655,9 @@ Pipe MergeTreeDataSelectExecutor::readFromParts(
         .min_bytes_to_use_direct_io = settings.min_bytes_to_use_direct_io,
         .min_bytes_to_use_mmap_io = settings.min_bytes_to_use_mmap_io,
         .max_read_buffer_size = settings.max_read_buffer_size,
-        .save_marks_in_cache = true
+        .save_marks_in_cache = true,
+        .prefetch_column_streams = settings.merge_tree_prefetch_column_streams,
+        .checksum_on_read = data.getSettings()->checksum_on_read,
     };
 
     /// PREWHERE
@@ -575,6 +675,11 @@ Pipe MergeTreeDataSelectExecutor::readFromParts(
             useful_indices.emplace_back(index_helper, condition);
     }
 
+    /// Index granules are immutable for the lifetime of a part, so let repeated queries hit
+    /// the global caches instead of re-reading and re-decompressing the .idx files every time.
+    auto mark_cache = context.getMarkCache();
+    auto uncompressed_cache = settings.use_uncompressed_cache ? context.getUncompressedCache() : nullptr;
+
     RangesInDataParts parts_with_ranges(parts.size());
     size_t sum_marks = 0;
     std::atomic<size_t> sum_marks_pk = 0;
@@ -607,7 +712,11 @@ Pipe MergeTreeDataSelectExecutor::readFromParts(
 
             for (const auto & index_and_condition : useful_indices)
                 ranges.ranges = filterMarksUsingIndex(
-                        index_and_condition.first, index_and_condition.second, part, ranges.ranges, settings, reader_settings, log);
+                        index_and_condition.first, index_and_condition.second, part, ranges.ranges,
+                        settings, reader_settings, mark_cache.get(), uncompressed_cache.get(), log);
+
+            if (sample_by_granules && !ranges.ranges.empty())
+                ranges.ranges = sampleMarkRanges(ranges.ranges, part->name, relative_sample_offset, relative_sample_size);
 
             if (!ranges.ranges.empty())
             {
@@ -658,6 +767,7 @@ Pipe MergeTreeDataSelectExecutor::readFromParts(
 
         /// Skip empty ranges.
         size_t next_part = 0;
+        std::unordered_map<String, size_t> marks_read_per_partition;
         for (size_t part_index = 0; part_index < parts.size(); ++part_index)
         {
             auto & part = parts_with_ranges[part_index];
@@ -666,6 +776,7 @@ Pipe MergeTreeDataSelectExecutor::readFromParts(
 
             sum_ranges += part.ranges.size();
             sum_marks += part.getMarksCount();
+            marks_read_per_partition[part.data_part->info.partition_id] += part.getMarksCount();
 
             if (next_part != part_index)
                 std::swap(parts_with_ranges[next_part], part);
@@ -674,6 +785,10 @@ Pipe MergeTreeDataSelectExecutor::readFromParts(
         }
 
         parts_with_ranges.resize(next_part);
+
+        /// Let the merge selector know which partitions the queries actually touch.
+        for (const auto & [partition_id, marks_read] : marks_read_per_partition)
+            data.reportPartitionRead(partition_id, marks_read);
     }
 
     LOG_DEBUG(log, "Selected {} parts by date, {} parts by key, {} marks by primary key, {} marks to read from {} ranges", parts.size(), parts_with_ranges.size(), sum_marks_pk.load(std::memory_order_relaxed), sum_marks, sum_ranges);
@@ -757,7 +872,7 @@ Pipe MergeTreeDataSelectExecutor::readFromParts(
             reader_settings);
     }
 
-    if (use_sampling)
+    if (use_sampling && !sample_by_granules)
     {
         res.addSimpleTransform([&filter_expression, &filter_function](const Block & header)
         {
@@ -875,7 +990,16 @@ Pipe MergeTreeDataSelectExecutor::spreadMarkRangesAmongStreams(
         Pipes res;
 
         /// Reduce the number of num_streams if the data is small.
-        if (sum_marks < num_streams * min_marks_for_concurrent_read && parts.size() < num_streams)
+        if (settings.merge_tree_adaptive_read_streams)
+        {
+            /// Size the number of streams from the data volume alone, so that each stream
+            /// gets at least min_marks_for_concurrent_read marks. The read pool steals work
+            /// between threads, so a small stream count does not strand any marks.
+            size_t streams_for_marks = (sum_marks + min_marks_for_concurrent_read - 1) / min_marks_for_concurrent_read;
+            num_streams = std::min(num_streams,
+                std::max(streams_for_marks, std::max<size_t>(1, settings.merge_tree_min_read_streams)));
+        }
+        else if (sum_marks < num_streams * min_marks_for_concurrent_read && parts.size() < num_streams)
             num_streams = std::max((sum_marks + min_marks_for_concurrent_read - 1) / min_marks_for_concurrent_read, parts.size());
 
         MergeTreeReadPoolPtr pool = std::make_shared<MergeTreeReadPool>(
@@ -1221,74 +1345,62 @@ Pipe MergeTreeDataSelectExecutor::spreadMarkRangesAmongStreamsFinal(
     if (sum_marks > max_marks_to_use_cache)
         use_uncompressed_cache = false;
 
-    Pipe pipe;
+    if (num_streams > settings.max_final_threads)
+        num_streams = settings.max_final_threads;
 
+    /// Background merges never collapse rows across partitions, so with
+    /// do_not_merge_across_partitions_select_final each partition can be finalized
+    /// independently and the pipelines run concurrently. The result differs from plain FINAL
+    /// only for rows with equal sorting key that ended up in different partitions: plain FINAL
+    /// collapses them, background merges (and therefore this mode) do not — hence the opt-in
+    /// setting. A partition represented by a single part that has been merged at least once
+    /// (level > 0) has nothing left to collapse and skips the merging transform entirely.
+    std::vector<RangesInDataParts> parts_per_merge_group;
+    if (settings.do_not_merge_across_partitions_select_final)
     {
-        Pipes pipes;
-
-        for (const auto & part : parts)
-        {
-            auto source_processor = std::make_shared<MergeTreeSelectProcessor>(
-                    data, metadata_snapshot, part.data_part, max_block_size, settings.preferred_block_size_bytes,
-                    settings.preferred_max_column_in_block_size_bytes, column_names, part.ranges,
-                    use_uncompressed_cache,
-                    query_info.prewhere_info, true, reader_settings,
-                    virt_columns, part.part_index_in_query);
-
-            pipes.emplace_back(std::move(source_processor));
-        }
+        std::map<String, RangesInDataParts> parts_per_partition;
+        for (auto & part : parts)
+            parts_per_partition[part.data_part->info.partition_id].emplace_back(std::move(part));
 
-        pipe = Pipe::unitePipes(std::move(pipes));
+        parts_per_merge_group.reserve(parts_per_partition.size());
+        for (auto & [partition_id, partition_parts] : parts_per_partition)
+            parts_per_merge_group.emplace_back(std::move(partition_parts));
     }
-
-    /// Drop temporary columns, added by 'sorting_key_expr'
-    if (!out_projection)
-        out_projection = createProjection(pipe, data);
-
-    pipe.addSimpleTransform([&metadata_snapshot](const Block & header)
-    {
-        return std::make_shared<ExpressionTransform>(header, metadata_snapshot->getSortingKey().expression);
-    });
+    else
+        parts_per_merge_group.emplace_back(std::move(parts));
 
     Names sort_columns = metadata_snapshot->getSortingKeyColumns();
-    SortDescription sort_description;
     size_t sort_columns_size = sort_columns.size();
-    sort_description.reserve(sort_columns_size);
-
     Names partition_key_columns = metadata_snapshot->getPartitionKey().column_names;
 
-    Block header = pipe.getHeader();
-    for (size_t i = 0; i < sort_columns_size; ++i)
-        sort_description.emplace_back(header.getPositionByName(sort_columns[i]), 1, 1);
-
-    auto get_merging_processor = [&]() -> MergingTransformPtr
+    auto get_merging_processor = [&](const Block & header, size_t num_outputs, const SortDescription & sort_description) -> MergingTransformPtr
     {
         switch (data.merging_params.mode)
         {
             case MergeTreeData::MergingParams::Ordinary:
             {
-                return std::make_shared<MergingSortedTransform>(header, pipe.numOutputPorts(),
+                return std::make_shared<MergingSortedTransform>(header, num_outputs,
                            sort_description, max_block_size);
             }
 
             case MergeTreeData::MergingParams::Collapsing:
-                return std::make_shared<CollapsingSortedTransform>(header, pipe.numOutputPorts(),
+                return std::make_shared<CollapsingSortedTransform>(header, num_outputs,
                            sort_description, data.merging_params.sign_column, true, max_block_size);
 
             case MergeTreeData::MergingParams::Summing:
-                return std::make_shared<SummingSortedTransform>(header, pipe.numOutputPorts(),
+                return std::make_shared<SummingSortedTransform>(header, num_outputs,
                            sort_description, data.merging_params.columns_to_sum, partition_key_columns, max_block_size);
 
             case MergeTreeData::MergingParams::Aggregating:
-                return std::make_shared<AggregatingSortedTransform>(header, pipe.numOutputPorts(),
+                return std::make_shared<AggregatingSortedTransform>(header, num_outputs,
                            sort_description, max_block_size);
 
             case MergeTreeData::MergingParams::Replacing:
-                return std::make_shared<ReplacingSortedTransform>(header, pipe.numOutputPorts(),
+                return std::make_shared<ReplacingSortedTransform>(header, num_outputs,
                            sort_description, data.merging_params.version_column, max_block_size);
 
             case MergeTreeData::MergingParams::VersionedCollapsing:
-                return std::make_shared<VersionedCollapsingTransform>(header, pipe.numOutputPorts(),
+                return std::make_shared<VersionedCollapsingTransform>(header, num_outputs,
                            sort_description, data.merging_params.sign_column, max_block_size);
 
             case MergeTreeData::MergingParams::Graphite:
@@ -1298,67 +1410,119 @@ Pipe MergeTreeDataSelectExecutor::spreadMarkRangesAmongStreamsFinal(
         __builtin_unreachable();
     };
 
-    if (num_streams > settings.max_final_threads)
-        num_streams = settings.max_final_threads;
+    Pipes merged_pipes;
+    merged_pipes.reserve(parts_per_merge_group.size());
 
-    if (num_streams <= 1 || sort_description.empty())
+    for (auto & merge_group : parts_per_merge_group)
     {
-        pipe.addTransform(get_merging_processor());
-        return pipe;
-    }
+        const bool no_merging_needed = settings.do_not_merge_across_partitions_select_final
+            && merge_group.size() == 1 && merge_group.front().data_part->info.level > 0;
 
-    ColumnNumbers key_columns;
-    key_columns.reserve(sort_description.size());
+        Pipe pipe;
 
-    for (auto & desc : sort_description)
-    {
-        if (!desc.column_name.empty())
-            key_columns.push_back(header.getPositionByName(desc.column_name));
-        else
-            key_columns.emplace_back(desc.column_number);
-    }
+        {
+            Pipes pipes;
 
-    pipe.addSimpleTransform([&](const Block & stream_header)
-    {
-        return std::make_shared<AddingSelectorTransform>(stream_header, num_streams, key_columns);
-    });
+            for (const auto & part : merge_group)
+            {
+                auto source_processor = std::make_shared<MergeTreeSelectProcessor>(
+                        data, metadata_snapshot, part.data_part, max_block_size, settings.preferred_block_size_bytes,
+                        settings.preferred_max_column_in_block_size_bytes, column_names, part.ranges,
+                        use_uncompressed_cache,
+                        query_info.prewhere_info, true, reader_settings,
+                        virt_columns, part.part_index_in_query);
+
+                pipes.emplace_back(std::move(source_processor));
+            }
 
-    pipe.transform([&](OutputPortRawPtrs ports)
-    {
-        Processors processors;
-        std::vector<OutputPorts::iterator> output_ports;
-        processors.reserve(ports.size() + num_streams);
-        output_ports.reserve(ports.size());
+            pipe = Pipe::unitePipes(std::move(pipes));
+        }
+
+        /// Drop temporary columns, added by 'sorting_key_expr'
+        if (!out_projection)
+            out_projection = createProjection(pipe, data);
+
+        pipe.addSimpleTransform([&metadata_snapshot](const Block & stream_header)
+        {
+            return std::make_shared<ExpressionTransform>(stream_header, metadata_snapshot->getSortingKey().expression);
+        });
 
-        for (auto & port : ports)
+        if (no_merging_needed)
         {
-            auto copier = std::make_shared<CopyTransform>(header, num_streams);
-            connect(*port, copier->getInputPort());
-            output_ports.emplace_back(copier->getOutputs().begin());
-            processors.emplace_back(std::move(copier));
+            merged_pipes.emplace_back(std::move(pipe));
+            continue;
         }
 
-        for (size_t i = 0; i < num_streams; ++i)
+        Block header = pipe.getHeader();
+        SortDescription sort_description;
+        sort_description.reserve(sort_columns_size);
+        for (size_t i = 0; i < sort_columns_size; ++i)
+            sort_description.emplace_back(header.getPositionByName(sort_columns[i]), 1, 1);
+
+        /// When merge groups are processed independently, parallelism comes from running them
+        /// concurrently and each group is collapsed by a single merging transform.
+        if (parts_per_merge_group.size() > 1 || num_streams <= 1 || sort_description.empty())
         {
-            auto merge = get_merging_processor();
-            merge->setSelectorPosition(i);
-            auto input = merge->getInputs().begin();
+            pipe.addTransform(get_merging_processor(header, pipe.numOutputPorts(), sort_description));
+            merged_pipes.emplace_back(std::move(pipe));
+            continue;
+        }
+
+        ColumnNumbers key_columns;
+        key_columns.reserve(sort_description.size());
 
-            /// Connect i-th merge with i-th input port of every copier.
-            for (size_t j = 0; j < ports.size(); ++j)
+        for (auto & desc : sort_description)
+        {
+            if (!desc.column_name.empty())
+                key_columns.push_back(header.getPositionByName(desc.column_name));
+            else
+                key_columns.emplace_back(desc.column_number);
+        }
+
+        pipe.addSimpleTransform([&](const Block & stream_header)
+        {
+            return std::make_shared<AddingSelectorTransform>(stream_header, num_streams, key_columns);
+        });
+
+        pipe.transform([&](OutputPortRawPtrs ports)
+        {
+            Processors processors;
+            std::vector<OutputPorts::iterator> output_ports;
+            processors.reserve(ports.size() + num_streams);
+            output_ports.reserve(ports.size());
+
+            for (auto & port : ports)
             {
-                connect(*output_ports[j], *input);
-                ++output_ports[j];
-                ++input;
+                auto copier = std::make_shared<CopyTransform>(header, num_streams);
+                connect(*port, copier->getInputPort());
+                output_ports.emplace_back(copier->getOutputs().begin());
+                processors.emplace_back(std::move(copier));
             }
 
-            processors.emplace_back(std::move(merge));
-        }
+            for (size_t i = 0; i < num_streams; ++i)
+            {
+                auto merge = get_merging_processor(header, ports.size(), sort_description);
+                merge->setSelectorPosition(i);
+                auto input = merge->getInputs().begin();
+
+                /// Connect i-th merge with i-th input port of every copier.
+                for (size_t j = 0; j < ports.size(); ++j)
+                {
+                    connect(*output_ports[j], *input);
+                    ++output_ports[j];
+                    ++input;
+                }
+
+                processors.emplace_back(std::move(merge));
+            }
+
+            return processors;
+        });
 
-        return processors;
-    });
+        merged_pipes.emplace_back(std::move(pipe));
+    }
 
-    return pipe;
+    return Pipe::unitePipes(std::move(merged_pipes));
 }
 
 /// Calculates a set of mark ranges, that could possibly contain keys, required by condition.
@@ -1579,6 +1743,8 @@ MarkRanges MergeTreeDataSelectExecutor::filterMarksUsingIndex(
     const MarkRanges & ranges,
     const Settings & settings,
     const MergeTreeReaderSettings & reader_settings,
+    MarkCache * mark_cache,
+    UncompressedCache * uncompressed_cache,
     Poco::Logger * log)
 {
     if (!part->volume->getDisk()->exists(part->getFullRelativePath() + index_helper->getFileName() + ".idx"))
@@ -1606,6 +1772,8 @@ MarkRanges MergeTreeDataSelectExecutor::filterMarksUsingIndex(
         index_helper, part,
         index_marks_count,
         ranges,
+        mark_cache,
+        uncompressed_cache,
         reader_settings);
 
     MarkRanges res;
@@ -1625,16 +1793,27 @@ MarkRanges MergeTreeDataSelectExecutor::filterMarksUsingIndex(
 
         total_granules += index_range.end - index_range.begin;
 
+        /// Read all granules of the range and evaluate the condition on the whole batch at once:
+        /// conditions may process a batch much cheaper than the same granules one-by-one.
+        std::vector<MergeTreeIndexGranulePtr> granules;
+        granules.reserve(index_range.end - index_range.begin);
         for (size_t index_mark = index_range.begin; index_mark < index_range.end; ++index_mark)
         {
             if (index_mark != index_range.begin || !granule || last_index_mark != index_range.begin)
                 granule = reader.read();
 
+            granules.push_back(granule);
+        }
+
+        auto may_be_true = condition->mayBeTrueOnGranules(granules);
+
+        for (size_t index_mark = index_range.begin; index_mark < index_range.end; ++index_mark)
+        {
             MarkRange data_range(
                     std::max(range.begin, index_mark * index_granularity),
                     std::min(range.end, (index_mark + 1) * index_granularity));
 
-            if (!condition->mayBeTrueOnGranule(granule))
+            if (!may_be_true[index_mark - index_range.begin])
             {
                 ++granules_dropped;
                 continue;
@@ -10,6 +10,8 @@ namespace DB
 {
 
 class KeyCondition;
+class MarkCache;
+class UncompressedCache;
 
 
 /** Executes SELECT queries on data from the merge tree.
@@ -109,6 +111,8 @@ private:
         const MarkRanges & ranges,
         const Settings & settings,
         const MergeTreeReaderSettings & reader_settings,
+        MarkCache * mark_cache,
+        UncompressedCache * uncompressed_cache,
         Poco::Logger * log);
 };
 
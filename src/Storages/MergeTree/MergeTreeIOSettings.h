@@ -1,6 +1,7 @@
 #pragma once
 #include <cstddef>
 #include <Core/Settings.h>
+#include <Storages/MergeTree/MergeTreeSettings.h>
 
 namespace DB
 {
@@ -13,16 +14,22 @@ struct MergeTreeReaderSettings
     /// If save_marks_in_cache is false, then, if marks are not in cache,
     ///  we will load them but won't save in the cache, to avoid evicting other data.
     bool save_marks_in_cache = false;
+    /// Hint the OS to read ahead compressed data of all column streams before deserializing a mark range.
+    bool prefetch_column_streams = false;
+    /// Validate checksums on reading (see the checksum_on_read MergeTree setting).
+    bool checksum_on_read = true;
 };
 
 struct MergeTreeWriterSettings
 {
     MergeTreeWriterSettings() = default;
 
-    MergeTreeWriterSettings(const Settings & global_settings, bool can_use_adaptive_granularity_,
-        size_t aio_threshold_, bool blocks_are_granules_size_ = false)
-        : min_compress_block_size(global_settings.min_compress_block_size)
-        , max_compress_block_size(global_settings.min_compress_block_size)
+    MergeTreeWriterSettings(const Settings & global_settings, const MergeTreeSettingsPtr & storage_settings,
+        bool can_use_adaptive_granularity_, size_t aio_threshold_, bool blocks_are_granules_size_ = false)
+        : min_compress_block_size(storage_settings->min_compress_block_size
+            ? storage_settings->min_compress_block_size : global_settings.min_compress_block_size)
+        , max_compress_block_size(storage_settings->max_compress_block_size
+            ? storage_settings->max_compress_block_size : global_settings.max_compress_block_size)
         , aio_threshold(aio_threshold_)
         , can_use_adaptive_granularity(can_use_adaptive_granularity_)
         , blocks_are_granules_size(blocks_are_granules_size_) {}
@@ -205,6 +205,99 @@ bool MergeTreeIndexConditionBloomFilter::mayBeTrueOnGranule(const MergeTreeIndex
     return rpn_stack[0].can_be_true;
 }
 
+std::vector<bool> MergeTreeIndexConditionBloomFilter::mayBeTrueOnGranules(const std::vector<MergeTreeIndexGranulePtr> & granules) const
+{
+    size_t num_granules = granules.size();
+
+    std::vector<const MergeTreeIndexGranuleBloomFilter *> bf_granules;
+    bf_granules.reserve(num_granules);
+    for (const auto & granule : granules)
+    {
+        const auto * bf_granule = typeid_cast<const MergeTreeIndexGranuleBloomFilter *>(granule.get());
+        if (!bf_granule)
+            throw Exception("LOGICAL ERROR: require bloom filter index granule.", ErrorCodes::LOGICAL_ERROR);
+        bf_granules.push_back(bf_granule);
+    }
+
+    /// The same RPN as in mayBeTrueOnGranule, but evaluated for the whole batch of granules per
+    /// RPN element: each probed hash column stays hot in cache while we walk the bloom filters
+    /// of all granules in a row.
+    using BoolMasks = std::vector<BoolMask>;
+    std::vector<BoolMasks> rpn_stack;
+
+    for (const auto & element : rpn)
+    {
+        if (element.function == RPNElement::FUNCTION_UNKNOWN)
+        {
+            rpn_stack.emplace_back(num_granules, BoolMask(true, true));
+        }
+        else if (element.function == RPNElement::FUNCTION_IN
+            || element.function == RPNElement::FUNCTION_NOT_IN
+            || element.function == RPNElement::FUNCTION_EQUALS
+            || element.function == RPNElement::FUNCTION_NOT_EQUALS
+            || element.function == RPNElement::FUNCTION_HAS)
+        {
+            BoolMasks masks(num_granules, BoolMask(true, true));
+            const auto & predicate = element.predicate;
+
+            for (const auto & query_index_hash : predicate)
+            {
+                const ColumnPtr & hash_column = query_index_hash.second;
+                for (size_t i = 0; i < num_granules; ++i)
+                {
+                    if (!masks[i].can_be_true)
+                        continue;
+                    const auto & filter = bf_granules[i]->getFilters()[query_index_hash.first];
+                    masks[i].can_be_true = maybeTrueOnBloomFilter(&*hash_column, filter, hash_functions);
+                }
+            }
+
+            if (element.function == RPNElement::FUNCTION_NOT_EQUALS || element.function == RPNElement::FUNCTION_NOT_IN)
+                for (auto & mask : masks)
+                    mask = !mask;
+
+            rpn_stack.emplace_back(std::move(masks));
+        }
+        else if (element.function == RPNElement::FUNCTION_NOT)
+        {
+            for (auto & mask : rpn_stack.back())
+                mask = !mask;
+        }
+        else if (element.function == RPNElement::FUNCTION_OR)
+        {
+            auto args = std::move(rpn_stack.back());
+            rpn_stack.pop_back();
+            for (size_t i = 0; i < num_granules; ++i)
+                rpn_stack.back()[i] = args[i] | rpn_stack.back()[i];
+        }
+        else if (element.function == RPNElement::FUNCTION_AND)
+        {
+            auto args = std::move(rpn_stack.back());
+            rpn_stack.pop_back();
+            for (size_t i = 0; i < num_granules; ++i)
+                rpn_stack.back()[i] = args[i] & rpn_stack.back()[i];
+        }
+        else if (element.function == RPNElement::ALWAYS_TRUE)
+        {
+            rpn_stack.emplace_back(num_granules, BoolMask(true, false));
+        }
+        else if (element.function == RPNElement::ALWAYS_FALSE)
+        {
+            rpn_stack.emplace_back(num_granules, BoolMask(false, true));
+        }
+        else
+            throw Exception("Unexpected function type in KeyCondition::RPNElement", ErrorCodes::LOGICAL_ERROR);
+    }
+
+    if (rpn_stack.size() != 1)
+        throw Exception("Unexpected stack size in MergeTreeIndexConditionBloomFilter::mayBeTrueOnGranules", ErrorCodes::LOGICAL_ERROR);
+
+    std::vector<bool> res(num_granules);
+    for (size_t i = 0; i < num_granules; ++i)
+        res[i] = rpn_stack[0][i].can_be_true;
+    return res;
+}
+
 bool MergeTreeIndexConditionBloomFilter::traverseAtomAST(const ASTPtr & node, Block & block_with_constants, RPNElement & out)
 {
     {
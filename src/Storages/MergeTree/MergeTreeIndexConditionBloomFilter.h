@@ -54,6 +54,8 @@ public:
         throw Exception("LOGICAL ERROR: require bloom filter index granule.", ErrorCodes::LOGICAL_ERROR);
     }
 
+    std::vector<bool> mayBeTrueOnGranules(const std::vector<MergeTreeIndexGranulePtr> & granules) const override;
+
 private:
     const Block & header;
     const Context & context;
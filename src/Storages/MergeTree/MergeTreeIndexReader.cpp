@@ -6,12 +6,12 @@ namespace DB
 
 MergeTreeIndexReader::MergeTreeIndexReader(
     MergeTreeIndexPtr index_, MergeTreeData::DataPartPtr part_, size_t marks_count_, const MarkRanges & all_mark_ranges_,
-    MergeTreeReaderSettings settings)
+    MarkCache * mark_cache, UncompressedCache * uncompressed_cache, MergeTreeReaderSettings settings)
     : index(index_), stream(
         part_->volume->getDisk(),
         part_->getFullRelativePath() + index->getFileName(), ".idx", marks_count_,
         all_mark_ranges_,
-        std::move(settings), nullptr, nullptr,
+        std::move(settings), mark_cache, uncompressed_cache,
         part_->getFileSizeOrZero(index->getFileName() + ".idx"),
         &part_->index_granularity_info,
         ReadBufferFromFileBase::ProfileCallback{}, CLOCK_MONOTONIC_COARSE)
@@ -15,6 +15,8 @@ public:
         MergeTreeData::DataPartPtr part_,
         size_t marks_count_,
         const MarkRanges & all_mark_ranges_,
+        MarkCache * mark_cache,
+        UncompressedCache * uncompressed_cache,
         MergeTreeReaderSettings settings);
 
     void seek(size_t mark);
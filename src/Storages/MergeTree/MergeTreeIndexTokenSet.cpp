@@ -0,0 +1,410 @@
+#include <Storages/MergeTree/MergeTreeIndexTokenSet.h>
+
+#include <IO/WriteHelpers.h>
+#include <IO/ReadHelpers.h>
+#include <Storages/MergeTree/RPNBuilder.h>
+#include <Parsers/ASTFunction.h>
+#include <Parsers/ASTExpressionList.h>
+
+
+namespace DB
+{
+
+namespace ErrorCodes
+{
+    extern const int LOGICAL_ERROR;
+    extern const int INCORRECT_QUERY;
+    extern const int BAD_ARGUMENTS;
+}
+
+
+/// Adds all tokens from string to the set.
+static void stringToTokenSet(
+    const char * data, size_t size, TokenExtractorPtr token_extractor, std::set<String> & tokens)
+{
+    size_t cur = 0;
+    size_t token_start = 0;
+    size_t token_len = 0;
+    while (cur < size && token_extractor->next(data, size, &cur, &token_start, &token_len))
+        tokens.emplace(data + token_start, token_len);
+}
+
+/// Adds all tokens from like pattern string to the set. (Because like pattern can contain `\%` and `\_`.)
+static void likeStringToTokenSet(
+    const String & data, TokenExtractorPtr token_extractor, std::set<String> & tokens)
+{
+    size_t cur = 0;
+    String token;
+    while (cur < data.size() && token_extractor->nextLike(data, &cur, token))
+        tokens.insert(token);
+}
+
+
+MergeTreeIndexGranuleTokenSet::MergeTreeIndexGranuleTokenSet(
+    const String & index_name_,
+    size_t columns_number,
+    size_t max_tokens_)
+    : index_name(index_name_)
+    , max_tokens(max_tokens_)
+    , token_sets(columns_number)
+    , overflowed(columns_number, 0)
+    , has_elems(false)
+{
+}
+
+void MergeTreeIndexGranuleTokenSet::serializeBinary(WriteBuffer & ostr) const
+{
+    if (empty())
+        throw Exception("Attempt to write empty token set index " + backQuote(index_name), ErrorCodes::LOGICAL_ERROR);
+
+    for (size_t col = 0; col < token_sets.size(); ++col)
+    {
+        writeBinary(overflowed[col], ostr);
+        writeVarUInt(token_sets[col].size(), ostr);
+        for (const auto & token : token_sets[col])
+            writeStringBinary(token, ostr);
+    }
+}
+
+void MergeTreeIndexGranuleTokenSet::deserializeBinary(ReadBuffer & istr)
+{
+    for (size_t col = 0; col < token_sets.size(); ++col)
+    {
+        readBinary(overflowed[col], istr);
+        size_t num_tokens = 0;
+        readVarUInt(num_tokens, istr);
+
+        token_sets[col].clear();
+        String token;
+        for (size_t i = 0; i < num_tokens; ++i)
+        {
+            readStringBinary(token, istr);
+            token_sets[col].insert(token);
+        }
+    }
+    has_elems = true;
+}
+
+
+MergeTreeIndexAggregatorTokenSet::MergeTreeIndexAggregatorTokenSet(
+    const Names & index_columns_,
+    const String & index_name_,
+    size_t max_tokens_,
+    TokenExtractorPtr token_extractor_)
+    : index_columns(index_columns_)
+    , index_name(index_name_)
+    , max_tokens(max_tokens_)
+    , token_extractor(token_extractor_)
+    , granule(
+        std::make_shared<MergeTreeIndexGranuleTokenSet>(
+            index_name, index_columns.size(), max_tokens))
+{
+}
+
+MergeTreeIndexGranulePtr MergeTreeIndexAggregatorTokenSet::getGranuleAndReset()
+{
+    auto new_granule = std::make_shared<MergeTreeIndexGranuleTokenSet>(
+        index_name, index_columns.size(), max_tokens);
+    new_granule.swap(granule);
+    return new_granule;
+}
+
+void MergeTreeIndexAggregatorTokenSet::update(const Block & block, size_t * pos, size_t limit)
+{
+    if (*pos >= block.rows())
+        throw Exception(
+                "The provided position is not less than the number of block rows. Position: "
+                + toString(*pos) + ", Block rows: " + toString(block.rows()) + ".", ErrorCodes::LOGICAL_ERROR);
+
+    size_t rows_read = std::min(limit, block.rows() - *pos);
+
+    for (size_t col = 0; col < index_columns.size(); ++col)
+    {
+        if (granule->overflowed[col])
+            continue;
+
+        const auto & column = block.getByName(index_columns[col]).column;
+        for (size_t i = 0; i < rows_read; ++i)
+        {
+            auto ref = column->getDataAt(*pos + i);
+            stringToTokenSet(ref.data, ref.size, token_extractor, granule->token_sets[col]);
+
+            if (max_tokens && granule->token_sets[col].size() > max_tokens)
+            {
+                granule->token_sets[col].clear();
+                granule->overflowed[col] = 1;
+                break;
+            }
+        }
+    }
+    granule->has_elems = true;
+    *pos += rows_read;
+}
+
+
+MergeTreeConditionTokenSet::MergeTreeConditionTokenSet(
+    const SelectQueryInfo & query_info,
+    const Context & context,
+    const Block & index_sample_block,
+    TokenExtractorPtr token_extractor_)
+    : index_columns(index_sample_block.getNames())
+    , token_extractor(token_extractor_)
+{
+    rpn = std::move(
+            RPNBuilder<RPNElement>(
+                    query_info, context,
+                    [this] (const ASTPtr & node, const Context & /* context */, Block & block_with_constants, RPNElement & out) -> bool
+                    {
+                        return this->atomFromAST(node, block_with_constants, out);
+                    }).extractRPN());
+}
+
+bool MergeTreeConditionTokenSet::alwaysUnknownOrTrue() const
+{
+    /// Check like in KeyCondition.
+    std::vector<bool> rpn_stack;
+
+    for (const auto & element : rpn)
+    {
+        if (element.function == RPNElement::FUNCTION_UNKNOWN
+            || element.function == RPNElement::ALWAYS_TRUE)
+        {
+            rpn_stack.push_back(true);
+        }
+        else if (element.function == RPNElement::FUNCTION_EQUALS
+             || element.function == RPNElement::FUNCTION_NOT_EQUALS
+             || element.function == RPNElement::ALWAYS_FALSE)
+        {
+            rpn_stack.push_back(false);
+        }
+        else if (element.function == RPNElement::FUNCTION_NOT)
+        {
+            // do nothing
+        }
+        else if (element.function == RPNElement::FUNCTION_AND)
+        {
+            auto arg1 = rpn_stack.back();
+            rpn_stack.pop_back();
+            auto arg2 = rpn_stack.back();
+            rpn_stack.back() = arg1 && arg2;
+        }
+        else if (element.function == RPNElement::FUNCTION_OR)
+        {
+            auto arg1 = rpn_stack.back();
+            rpn_stack.pop_back();
+            auto arg2 = rpn_stack.back();
+            rpn_stack.back() = arg1 || arg2;
+        }
+        else
+            throw Exception("Unexpected function type in MergeTreeConditionTokenSet::RPNElement", ErrorCodes::LOGICAL_ERROR);
+    }
+
+    return rpn_stack[0];
+}
+
+bool MergeTreeConditionTokenSet::mayBeTrueOnGranule(MergeTreeIndexGranulePtr idx_granule) const
+{
+    std::shared_ptr<MergeTreeIndexGranuleTokenSet> granule
+            = std::dynamic_pointer_cast<MergeTreeIndexGranuleTokenSet>(idx_granule);
+    if (!granule)
+        throw Exception(
+                "Token set index condition got a granule with the wrong type.", ErrorCodes::LOGICAL_ERROR);
+
+    /// Check like in KeyCondition.
+    std::vector<BoolMask> rpn_stack;
+    for (const auto & element : rpn)
+    {
+        if (element.function == RPNElement::FUNCTION_UNKNOWN)
+        {
+            rpn_stack.emplace_back(true, true);
+        }
+        else if (element.function == RPNElement::FUNCTION_EQUALS
+             || element.function == RPNElement::FUNCTION_NOT_EQUALS)
+        {
+            bool maybe_true = true;
+            if (!granule->overflowed[element.key_column])
+            {
+                const auto & token_set = granule->token_sets[element.key_column];
+                for (const auto & token : element.tokens)
+                {
+                    if (!token_set.count(token))
+                    {
+                        maybe_true = false;
+                        break;
+                    }
+                }
+            }
+
+            rpn_stack.emplace_back(maybe_true, true);
+            if (element.function == RPNElement::FUNCTION_NOT_EQUALS)
+                rpn_stack.back() = !rpn_stack.back();
+        }
+        else if (element.function == RPNElement::FUNCTION_NOT)
+        {
+            rpn_stack.back() = !rpn_stack.back();
+        }
+        else if (element.function == RPNElement::FUNCTION_AND)
+        {
+            auto arg1 = rpn_stack.back();
+            rpn_stack.pop_back();
+            auto arg2 = rpn_stack.back();
+            rpn_stack.back() = arg1 & arg2;
+        }
+        else if (element.function == RPNElement::FUNCTION_OR)
+        {
+            auto arg1 = rpn_stack.back();
+            rpn_stack.pop_back();
+            auto arg2 = rpn_stack.back();
+            rpn_stack.back() = arg1 | arg2;
+        }
+        else if (element.function == RPNElement::ALWAYS_FALSE)
+        {
+            rpn_stack.emplace_back(false, true);
+        }
+        else if (element.function == RPNElement::ALWAYS_TRUE)
+        {
+            rpn_stack.emplace_back(true, false);
+        }
+        else
+            throw Exception("Unexpected function type in MergeTreeConditionTokenSet::RPNElement", ErrorCodes::LOGICAL_ERROR);
+    }
+
+    if (rpn_stack.size() != 1)
+        throw Exception("Unexpected stack size in MergeTreeConditionTokenSet::mayBeTrueOnGranule", ErrorCodes::LOGICAL_ERROR);
+
+    return rpn_stack[0].can_be_true;
+}
+
+bool MergeTreeConditionTokenSet::getKey(const ASTPtr & node, size_t & key_column_num)
+{
+    auto it = std::find(index_columns.begin(), index_columns.end(), node->getColumnName());
+    if (it == index_columns.end())
+        return false;
+
+    key_column_num = static_cast<size_t>(it - index_columns.begin());
+    return true;
+}
+
+bool MergeTreeConditionTokenSet::atomFromAST(
+    const ASTPtr & node, Block & block_with_constants, RPNElement & out)
+{
+    Field const_value;
+    DataTypePtr const_type;
+    if (const auto * func = typeid_cast<const ASTFunction *>(node.get()))
+    {
+        const ASTs & args = typeid_cast<const ASTExpressionList &>(*func->arguments).children;
+
+        if (args.size() != 2)
+            return false;
+
+        size_t key_column_num = -1;   /// Number of a key column (inside index_columns array)
+        const auto & func_name = func->name;
+
+        if (KeyCondition::getConstant(args[1], block_with_constants, const_value, const_type) && getKey(args[0], key_column_num))
+        {
+            /// Constant is the second argument, as expected.
+        }
+        else if (KeyCondition::getConstant(args[0], block_with_constants, const_value, const_type) && getKey(args[1], key_column_num))
+        {
+            /// Only the symmetric functions allow swapped arguments.
+            if (func_name != "equals" && func_name != "notEquals")
+                return false;
+        }
+        else
+            return false;
+
+        if (const_type && const_type->getTypeId() != TypeIndex::String
+                       && const_type->getTypeId() != TypeIndex::FixedString)
+            return false;
+
+        if (func_name == "equals" || func_name == "notEquals"
+            || func_name == "hasToken" || func_name == "startsWith" || func_name == "endsWith")
+        {
+            out.key_column = key_column_num;
+            out.function = func_name == "notEquals" ? RPNElement::FUNCTION_NOT_EQUALS : RPNElement::FUNCTION_EQUALS;
+
+            const auto & str = const_value.get<String>();
+            std::vector<String> tokens;
+            size_t cur = 0;
+            size_t token_start = 0;
+            size_t token_len = 0;
+            while (cur < str.size() && token_extractor->next(str.c_str(), str.size(), &cur, &token_start, &token_len))
+                tokens.emplace_back(str, token_start, token_len);
+
+            /// A token adjacent to the unanchored end of the value may be a fragment
+            /// of a longer token in the data, so it must not be required.
+            if (func_name == "startsWith" && !tokens.empty())
+                tokens.pop_back();
+            else if (func_name == "endsWith" && !tokens.empty())
+                tokens.erase(tokens.begin());
+
+            out.tokens = std::move(tokens);
+            return true;
+        }
+        else if (func_name == "like" || func_name == "notLike")
+        {
+            if (!token_extractor->supportLike())
+                return false;
+
+            out.key_column = key_column_num;
+            out.function = func_name == "notLike" ? RPNElement::FUNCTION_NOT_EQUALS : RPNElement::FUNCTION_EQUALS;
+
+            const auto & str = const_value.get<String>();
+            std::set<String> tokens;
+            likeStringToTokenSet(str, token_extractor, tokens);
+            out.tokens.assign(tokens.begin(), tokens.end());
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+MergeTreeIndexGranulePtr MergeTreeIndexTokenSet::createIndexGranule() const
+{
+    return std::make_shared<MergeTreeIndexGranuleTokenSet>(index.name, index.column_names.size(), max_tokens);
+}
+
+MergeTreeIndexAggregatorPtr MergeTreeIndexTokenSet::createIndexAggregator() const
+{
+    return std::make_shared<MergeTreeIndexAggregatorTokenSet>(index.column_names, index.name, max_tokens, token_extractor.get());
+}
+
+MergeTreeIndexConditionPtr MergeTreeIndexTokenSet::createIndexCondition(
+        const SelectQueryInfo & query, const Context & context) const
+{
+    return std::make_shared<MergeTreeConditionTokenSet>(query, context, index.sample_block, token_extractor.get());
+}
+
+bool MergeTreeIndexTokenSet::mayBenefitFromIndexForIn(const ASTPtr & /* node */) const
+{
+    /// The condition does not support IN.
+    return false;
+}
+
+
+MergeTreeIndexPtr tokenSetIndexCreator(const IndexDescription & index)
+{
+    size_t max_tokens = index.arguments.empty() ? 0 : index.arguments[0].get<size_t>();
+    auto tokenizer = std::make_unique<SplitTokenExtractor>();
+
+    return std::make_shared<MergeTreeIndexTokenSet>(index, max_tokens, std::move(tokenizer));
+}
+
+void tokenSetIndexValidator(const IndexDescription & index, bool /*attach*/)
+{
+    for (const auto & data_type : index.data_types)
+    {
+        if (data_type->getTypeId() != TypeIndex::String && data_type->getTypeId() != TypeIndex::FixedString)
+            throw Exception("Token set index can be used only with `String` or `FixedString` column.", ErrorCodes::INCORRECT_QUERY);
+    }
+
+    if (index.arguments.size() > 1)
+        throw Exception("`tokenset` index must have at most one argument.", ErrorCodes::INCORRECT_QUERY);
+
+    if (!index.arguments.empty() && index.arguments[0].getType() != Field::Types::UInt64)
+        throw Exception("`tokenset` index argument must be an unsigned integer.", ErrorCodes::BAD_ARGUMENTS);
+}
+
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <Storages/MergeTree/MergeTreeIndices.h>
+#include <Storages/MergeTree/MergeTreeIndexFullText.h>
+#include <Storages/MergeTree/KeyCondition.h>
+
+#include <memory>
+#include <set>
+
+
+namespace DB
+{
+
+/// Stores the exact set of tokens occurring in a granule.
+/// Unlike the bloom filter based full text index it never gives false positives,
+/// at the cost of larger index size. To bound the size, a granule whose token set
+/// exceeds `max_tokens` is marked as overflowed and always matches.
+struct MergeTreeIndexGranuleTokenSet : public IMergeTreeIndexGranule
+{
+    explicit MergeTreeIndexGranuleTokenSet(
+        const String & index_name_,
+        size_t columns_number,
+        size_t max_tokens_);
+
+    ~MergeTreeIndexGranuleTokenSet() override = default;
+
+    void serializeBinary(WriteBuffer & ostr) const override;
+    void deserializeBinary(ReadBuffer & istr) override;
+
+    bool empty() const override { return !has_elems; }
+
+    String index_name;
+    size_t max_tokens;
+
+    std::vector<std::set<String>> token_sets;
+    /// Per column: the token set was truncated, so membership tests are inconclusive.
+    std::vector<UInt8> overflowed;
+    bool has_elems;
+};
+
+using MergeTreeIndexGranuleTokenSetPtr = std::shared_ptr<MergeTreeIndexGranuleTokenSet>;
+
+struct MergeTreeIndexAggregatorTokenSet : IMergeTreeIndexAggregator
+{
+    explicit MergeTreeIndexAggregatorTokenSet(
+        const Names & index_columns_,
+        const String & index_name_,
+        size_t max_tokens_,
+        TokenExtractorPtr token_extractor_);
+
+    ~MergeTreeIndexAggregatorTokenSet() override = default;
+
+    bool empty() const override { return !granule || granule->empty(); }
+    MergeTreeIndexGranulePtr getGranuleAndReset() override;
+
+    void update(const Block & block, size_t * pos, size_t limit) override;
+
+    Names index_columns;
+    String index_name;
+    size_t max_tokens;
+    TokenExtractorPtr token_extractor;
+
+    MergeTreeIndexGranuleTokenSetPtr granule;
+};
+
+
+class MergeTreeConditionTokenSet : public IMergeTreeIndexCondition
+{
+public:
+    MergeTreeConditionTokenSet(
+            const SelectQueryInfo & query_info,
+            const Context & context,
+            const Block & index_sample_block,
+            TokenExtractorPtr token_extractor_);
+
+    ~MergeTreeConditionTokenSet() override = default;
+
+    bool alwaysUnknownOrTrue() const override;
+    bool mayBeTrueOnGranule(MergeTreeIndexGranulePtr idx_granule) const override;
+
+private:
+    /// Uses RPN like KeyCondition
+    struct RPNElement
+    {
+        enum Function
+        {
+            /// Atoms of a Boolean expression.
+            FUNCTION_EQUALS,
+            FUNCTION_NOT_EQUALS,
+            FUNCTION_UNKNOWN, /// Can take any value.
+            /// Operators of the logical expression.
+            FUNCTION_NOT,
+            FUNCTION_AND,
+            FUNCTION_OR,
+            /// Constants
+            ALWAYS_FALSE,
+            ALWAYS_TRUE,
+        };
+
+        RPNElement(Function function_ = FUNCTION_UNKNOWN) : function(function_) {}
+
+        Function function = FUNCTION_UNKNOWN;
+        /// For FUNCTION_EQUALS and FUNCTION_NOT_EQUALS
+        size_t key_column = 0;
+        /// Tokens which all must occur in the granule for the atom to be possibly true.
+        std::vector<String> tokens;
+    };
+
+    using RPN = std::vector<RPNElement>;
+
+    bool atomFromAST(const ASTPtr & node, Block & block_with_constants, RPNElement & out);
+
+    bool getKey(const ASTPtr & node, size_t & key_column_num);
+
+    Names index_columns;
+    TokenExtractorPtr token_extractor;
+    RPN rpn;
+};
+
+
+class MergeTreeIndexTokenSet : public IMergeTreeIndex
+{
+public:
+    MergeTreeIndexTokenSet(
+        const IndexDescription & index_,
+        size_t max_tokens_,
+        std::unique_ptr<ITokenExtractor> && token_extractor_)
+        : IMergeTreeIndex(index_)
+        , max_tokens(max_tokens_)
+        , token_extractor(std::move(token_extractor_)) {}
+
+    ~MergeTreeIndexTokenSet() override = default;
+
+    MergeTreeIndexGranulePtr createIndexGranule() const override;
+    MergeTreeIndexAggregatorPtr createIndexAggregator() const override;
+
+    MergeTreeIndexConditionPtr createIndexCondition(
+            const SelectQueryInfo & query, const Context & context) const override;
+
+    bool mayBenefitFromIndexForIn(const ASTPtr & node) const override;
+
+    /// Maximum number of tokens stored per column and granule, 0 is unlimited.
+    size_t max_tokens;
+    /// Function for selecting next token.
+    std::unique_ptr<ITokenExtractor> token_extractor;
+};
+
+}
@@ -98,6 +98,9 @@ MergeTreeIndexFactory::MergeTreeIndexFactory()
 
     registerCreator("bloom_filter", bloomFilterIndexCreatorNew);
     registerValidator("bloom_filter", bloomFilterIndexValidatorNew);
+
+    registerCreator("tokenset_v1", tokenSetIndexCreator);
+    registerValidator("tokenset_v1", tokenSetIndexValidator);
 }
 
 MergeTreeIndexFactory & MergeTreeIndexFactory::instance()
@@ -60,6 +60,17 @@ public:
     virtual bool alwaysUnknownOrTrue() const = 0;
 
     virtual bool mayBeTrueOnGranule(MergeTreeIndexGranulePtr granule) const = 0;
+
+    /// Batched variant: check the condition on a vector of granules at once.
+    /// Conditions may override it to amortize per-call setup over the whole batch.
+    virtual std::vector<bool> mayBeTrueOnGranules(const std::vector<MergeTreeIndexGranulePtr> & granules) const
+    {
+        std::vector<bool> res;
+        res.reserve(granules.size());
+        for (const auto & granule : granules)
+            res.push_back(mayBeTrueOnGranule(granule));
+        return res;
+    }
 };
 
 using MergeTreeIndexConditionPtr = std::shared_ptr<IMergeTreeIndexCondition>;
@@ -136,4 +147,7 @@ void bloomFilterIndexValidator(const IndexDescription & index, bool attach);
 MergeTreeIndexPtr bloomFilterIndexCreatorNew(const IndexDescription & index);
 void bloomFilterIndexValidatorNew(const IndexDescription & index, bool attach);
 
+MergeTreeIndexPtr tokenSetIndexCreator(const IndexDescription & index);
+void tokenSetIndexValidator(const IndexDescription & index, bool attach);
+
 }
@@ -327,7 +327,10 @@ void MergeTreeRangeReader::ReadResult::optimize(bool can_read_incomplete_granule
         return;
     }
     /// Just a guess. If only a few rows may be skipped, it's better not to skip at all.
-    else if (2 * total_zero_rows_in_tails > filter->size())
+    /// But if some granules were filtered out entirely, always collapse them: the next readers
+    /// of the chain will then skip the whole compressed blocks of those granules instead of
+    /// decompressing the remaining columns just to drop every row.
+    else if (2 * total_zero_rows_in_tails > filter->size() || hasFullyFilteredGranules(zero_tails))
     {
         for (auto i : ext::range(0, rows_per_granule.size()))
         {
@@ -365,6 +368,15 @@ void MergeTreeRangeReader::ReadResult::optimize(bool can_read_incomplete_granule
         need_filter = true;
 }
 
+bool MergeTreeRangeReader::ReadResult::hasFullyFilteredGranules(const NumRows & zero_tails) const
+{
+    for (auto i : ext::range(0, rows_per_granule.size()))
+        if (zero_tails[i] && zero_tails[i] == rows_per_granule[i])
+            return true;
+
+    return false;
+}
+
 size_t MergeTreeRangeReader::ReadResult::countZeroTails(const IColumn::Filter & filter_vec, NumRows & zero_tails, bool can_read_incomplete_granules) const
 {
     zero_tails.resize(0);
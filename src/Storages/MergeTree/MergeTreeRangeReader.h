@@ -199,6 +199,8 @@ public:
 
         void collapseZeroTails(const IColumn::Filter & filter, IColumn::Filter & new_filter);
         size_t countZeroTails(const IColumn::Filter & filter, NumRows & zero_tails, bool can_read_incomplete_granules) const;
+        /// Whether some granule was filtered out entirely, so that it may be skipped without reading.
+        bool hasFullyFilteredGranules(const NumRows & zero_tails) const;
         static size_t numZerosInTail(const UInt8 * begin, const UInt8 * end);
 
         std::map<const IColumn::Filter *, size_t> filter_bytes_map;
@@ -2,6 +2,7 @@
 #include <Storages/MergeTree/MergeTreeBaseSelectProcessor.h>
 #include <Common/formatReadable.h>
 #include <ext/range.h>
+#include <numeric>
 
 
 namespace ProfileEvents
@@ -61,8 +62,14 @@ MergeTreeReadTaskPtr MergeTreeReadPool::getTask(const size_t min_marks_to_read,
     if (!tasks_remaining_for_this_thread && do_not_steal_tasks)
         return nullptr;
 
+    /// If this thread has exhausted its backlog, steal about half of the most loaded thread's
+    /// remaining marks at once. Otherwise a single thread stuck with a slow (e.g. not in page cache)
+    /// part serves as a long tail while other threads nibble at it one batch at a time.
+    if (!tasks_remaining_for_this_thread)
+        stealTasks(thread, min_marks_to_read);
+
     /// Steal task if nothing to do and it's not prohibited
-    const auto thread_idx = tasks_remaining_for_this_thread ? thread : *std::begin(remaining_thread_tasks);
+    const auto thread_idx = !threads_tasks[thread].sum_marks_in_parts.empty() ? thread : *std::begin(remaining_thread_tasks);
     auto & thread_tasks = threads_tasks[thread_idx];
 
     auto & thread_task = thread_tasks.parts_and_ranges.back();
@@ -124,6 +131,92 @@ MergeTreeReadTaskPtr MergeTreeReadPool::getTask(const size_t min_marks_to_read,
         prewhere_info && prewhere_info->remove_prewhere_column, per_part_should_reorder[part_idx], std::move(curr_task_size_predictor));
 }
 
+void MergeTreeReadPool::stealTasks(const size_t thread, const size_t min_marks_to_read)
+{
+    /// Choose the most loaded thread as a victim, so that all threads tend to finish simultaneously.
+    ssize_t victim = -1;
+    size_t victim_marks = 0;
+    for (const auto candidate : remaining_thread_tasks)
+    {
+        if (candidate == thread)
+            continue;
+
+        const auto & candidate_tasks = threads_tasks[candidate];
+        const size_t marks = std::accumulate(
+            candidate_tasks.sum_marks_in_parts.begin(), candidate_tasks.sum_marks_in_parts.end(), static_cast<size_t>(0));
+
+        if (marks > victim_marks)
+        {
+            victim = candidate;
+            victim_marks = marks;
+        }
+    }
+
+    /// If the victim's backlog is small, leave it alone: the fine-grained stealing in getTask
+    /// will finish its tail without moving work around.
+    if (victim == -1 || victim_marks < 2 * min_marks_to_read)
+        return;
+
+    auto & victim_tasks = threads_tasks[victim];
+    auto & thief_tasks = threads_tasks[thread];
+
+    size_t marks_to_steal = victim_marks / 2;
+
+    /// Steal whole parts from the front of the victim's backlog: the victim consumes it from the back,
+    /// so per-part read buffers of both threads stay affine to a single thread.
+    while (marks_to_steal > 0 && !victim_tasks.parts_and_ranges.empty())
+    {
+        size_t & marks_in_part = victim_tasks.sum_marks_in_parts.front();
+        auto & part_task = victim_tasks.parts_and_ranges.front();
+
+        if (marks_in_part <= marks_to_steal)
+        {
+            thief_tasks.parts_and_ranges.push_back(std::move(part_task));
+            thief_tasks.sum_marks_in_parts.push_back(marks_in_part);
+            marks_to_steal -= marks_in_part;
+
+            victim_tasks.parts_and_ranges.erase(victim_tasks.parts_and_ranges.begin());
+            victim_tasks.sum_marks_in_parts.erase(victim_tasks.sum_marks_in_parts.begin());
+        }
+        else
+        {
+            /// The remaining work is within a single part: split its ranges and take the first half.
+            MarkRanges stolen_ranges;
+            size_t stolen_marks = 0;
+
+            while (marks_to_steal > 0 && !part_task.ranges.empty())
+            {
+                MarkRange & range = part_task.ranges.front();
+
+                const size_t marks_in_range = range.end - range.begin;
+                const size_t marks_to_get_from_range = std::min(marks_in_range, marks_to_steal);
+
+                stolen_ranges.emplace_back(range.begin, range.begin + marks_to_get_from_range);
+                range.begin += marks_to_get_from_range;
+                if (range.begin == range.end)
+                    part_task.ranges.pop_front();
+
+                marks_in_part -= marks_to_get_from_range;
+                stolen_marks += marks_to_get_from_range;
+                marks_to_steal -= marks_to_get_from_range;
+            }
+
+            if (stolen_marks)
+            {
+                thief_tasks.parts_and_ranges.push_back({ part_task.part_idx, std::move(stolen_ranges) });
+                thief_tasks.sum_marks_in_parts.push_back(stolen_marks);
+            }
+
+            break;
+        }
+    }
+
+    if (victim_tasks.sum_marks_in_parts.empty())
+        remaining_thread_tasks.erase(victim);
+    if (!thief_tasks.sum_marks_in_parts.empty())
+        remaining_thread_tasks.insert(thread);
+}
+
 MarkRanges MergeTreeReadPool::getRestMarks(const IMergeTreeDataPart & part, const MarkRange & from) const
 {
     MarkRanges all_part_ranges;
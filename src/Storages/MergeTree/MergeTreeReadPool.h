@@ -94,6 +94,10 @@ private:
         const size_t threads, const size_t sum_marks, std::vector<size_t> per_part_sum_marks,
         RangesInDataParts & parts, const size_t min_marks_for_concurrent_read);
 
+    /// Move about half of the most loaded thread's remaining marks to the backlog of @thread.
+    /// Called under `mutex` when @thread has run out of its own work.
+    void stealTasks(const size_t thread, const size_t min_marks_to_read);
+
     const MergeTreeData & data;
     StorageMetadataPtr metadata_snapshot;
     Names column_names;
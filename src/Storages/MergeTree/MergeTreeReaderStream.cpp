@@ -19,10 +19,11 @@ MergeTreeReaderStream::MergeTreeReaderStream(
         const MarkRanges & all_mark_ranges,
         const MergeTreeReaderSettings & settings,
         MarkCache * mark_cache_,
-        UncompressedCache * uncompressed_cache, size_t file_size,
+        UncompressedCache * uncompressed_cache, size_t file_size_,
         const MergeTreeIndexGranularityInfo * index_granularity_info_,
         const ReadBufferFromFileBase::ProfileCallback & profile_callback, clockid_t clock_type)
         : disk(std::move(disk_)), path_prefix(path_prefix_), data_file_extension(data_file_extension_), marks_count(marks_count_)
+        , file_size(file_size_)
         , mark_cache(mark_cache_), save_marks_in_cache(settings.save_marks_in_cache)
         , index_granularity_info(index_granularity_info_)
         , marks_loader(disk, mark_cache, index_granularity_info->getMarksFilePath(path_prefix),
@@ -96,6 +97,9 @@ MergeTreeReaderStream::MergeTreeReaderStream(
         if (profile_callback)
             buffer->setProfileCallback(profile_callback, clock_type);
 
+        if (!settings.checksum_on_read)
+            buffer->disableChecksumming();
+
         cached_buffer = std::move(buffer);
         data_buffer = cached_buffer.get();
     }
@@ -109,6 +113,9 @@ MergeTreeReaderStream::MergeTreeReaderStream(
         if (profile_callback)
             buffer->setProfileCallback(profile_callback, clock_type);
 
+        if (!settings.checksum_on_read)
+            buffer->disableChecksumming();
+
         non_cached_buffer = std::move(buffer);
         data_buffer = non_cached_buffer.get();
     }
@@ -159,4 +166,22 @@ void MergeTreeReaderStream::seekToStart()
     }
 }
 
+
+void MergeTreeReaderStream::prefetchMarkRange(size_t from_mark, size_t to_mark)
+{
+    if (from_mark >= marks_count)
+        return;
+
+    size_t offset_begin = marks_loader.getMark(from_mark).offset_in_compressed_file;
+    size_t offset_end = to_mark < marks_count ? marks_loader.getMark(to_mark).offset_in_compressed_file : file_size;
+
+    if (offset_begin >= offset_end)
+        return;
+
+    if (cached_buffer)
+        cached_buffer->prefetch(offset_begin, offset_end - offset_begin);
+    if (non_cached_buffer)
+        non_cached_buffer->prefetch(offset_begin, offset_end - offset_begin);
+}
+
 }
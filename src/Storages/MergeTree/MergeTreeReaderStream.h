@@ -22,13 +22,16 @@ public:
         const MarkRanges & all_mark_ranges,
         const MergeTreeReaderSettings & settings_,
         MarkCache * mark_cache, UncompressedCache * uncompressed_cache,
-        size_t file_size, const MergeTreeIndexGranularityInfo * index_granularity_info_,
+        size_t file_size_, const MergeTreeIndexGranularityInfo * index_granularity_info_,
         const ReadBufferFromFileBase::ProfileCallback & profile_callback, clockid_t clock_type);
 
     void seekToMark(size_t index);
 
     void seekToStart();
 
+    /// Hint the OS to read ahead the compressed data of marks [from_mark, to_mark).
+    void prefetchMarkRange(size_t from_mark, size_t to_mark);
+
     ReadBuffer * data_buffer;
 
 private:
@@ -37,6 +40,7 @@ private:
     std::string data_file_extension;
 
     size_t marks_count;
+    size_t file_size;
 
     MarkCache * mark_cache;
     bool save_marks_in_cache;
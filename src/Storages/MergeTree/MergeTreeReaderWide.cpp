@@ -69,6 +69,20 @@ size_t MergeTreeReaderWide::readRows(size_t from_mark, bool continue_reading, si
         size_t num_columns = columns.size();
         checkNumberOfColumns(num_columns);
 
+        /// Issue a readahead hint for every column stream over the whole mark range we are about to read,
+        /// so that cold reads of different columns overlap instead of being served strictly one after another.
+        if (settings.prefetch_column_streams && !continue_reading && !streams.empty())
+        {
+            const auto & index_granularity = data_part->index_granularity;
+
+            size_t to_mark = from_mark;
+            for (size_t rows = 0; to_mark < index_granularity.getMarksCount() && rows < max_rows_to_read; ++to_mark)
+                rows += index_granularity.getMarkRows(to_mark);
+
+            for (auto & stream : streams)
+                stream.second->prefetchMarkRange(from_mark, to_mark);
+        }
+
         /// Pointers to offset columns that are common to the nested data structure columns.
         /// If append is true, then the value will be equal to nullptr and will be used only to
         /// check that the offsets column has been already read.
@@ -50,6 +50,15 @@ MergeTreeWhereOptimizer::MergeTreeWhereOptimizer(
 }
 
 
+/// NOTE: These are real compressed on-disk sizes aggregated from the parts' checksums
+/// (getColumnCompressedSize), not uncompressed byte estimates — the cost side of the
+/// move-to-PREWHERE decision already reflects what a condition costs to read. The loop in
+/// optimize() also already moves multiple cheap conjuncts: cheapest first (with the
+/// equals-with-selective-constant "good" bonus as a crude selectivity proxy), capped at 10%
+/// of the total queried size. What is genuinely missing is a measured selectivity estimate
+/// per condition; that needs column statistics infrastructure (ANALYZE-style summaries
+/// stored per part), which this tree does not have — until it does, ordering by bytes with
+/// the "good" heuristic is the best available signal.
 void MergeTreeWhereOptimizer::calculateColumnSizes(const MergeTreeData & data, const Names & column_names)
 {
     for (const auto & column_name : column_names)
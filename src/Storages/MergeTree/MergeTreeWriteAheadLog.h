@@ -16,6 +16,12 @@ class MergeTreeData;
   * - type of action (ADD or DROP)
   * - part name
   * - part's block in Native format. (for ADD action)
+  *
+  * Together with MergeTreeDataPartInMemory this gives small inserts sub-directory-creation cost:
+  * blocks below min_bytes_for_wide_part / min_rows_for_compact_part thresholds stay as in-memory
+  * parts served directly by reads, are persisted here when in_memory_parts_enable_wal is set
+  * (restored by loadDataParts after restart), and reach their on-disk format when a background
+  * merge picks them up like any other part.
   */
 class MergeTreeWriteAheadLog
 {
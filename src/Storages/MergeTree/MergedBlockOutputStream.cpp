@@ -48,6 +48,7 @@ MergedBlockOutputStream::MergedBlockOutputStream(
 {
     MergeTreeWriterSettings writer_settings(
         storage.global_context.getSettings(),
+        storage.getSettings(),
         data_part->index_granularity_info.is_adaptive,
         aio_threshold,
         blocks_are_granules_size);
@@ -91,6 +92,7 @@ void MergedBlockOutputStream::writeSuffix()
 
 void MergedBlockOutputStream::writeSuffixAndFinalizePart(
         MergeTreeData::MutableDataPartPtr & new_part,
+        bool sync,
         const NamesAndTypesList * total_columns_list,
         MergeTreeData::DataPart::Checksums * additional_column_checksums)
 {
@@ -101,9 +103,9 @@ void MergedBlockOutputStream::writeSuffixAndFinalizePart(
         checksums = std::move(*additional_column_checksums);
 
     /// Finish columns serialization.
-    writer->finishDataSerialization(checksums);
-    writer->finishPrimaryIndexSerialization(checksums);
-    writer->finishSkipIndicesSerialization(checksums);
+    writer->finishDataSerialization(checksums, sync);
+    writer->finishPrimaryIndexSerialization(checksums, sync);
+    writer->finishSkipIndicesSerialization(checksums, sync);
 
     NamesAndTypesList part_columns;
     if (!total_columns_list)
@@ -158,6 +160,12 @@ void MergedBlockOutputStream::finalizePartOnDisk(
         checksums.files["ttl.txt"].file_hash = out_hashing.getHash();
     }
 
+    if (storage.getSettings()->write_column_minmax_statistics)
+    {
+        columns_statistics.store(part_columns, volume->getDisk(), part_path, checksums);
+        new_part->columns_statistics = columns_statistics;
+    }
+
     removeEmptyColumnsFromPart(new_part, part_columns, checksums);
 
     {
@@ -191,6 +199,9 @@ void MergedBlockOutputStream::writeImpl(const Block & block, const IColumn::Perm
     if (!rows)
         return;
 
+    if (storage.getSettings()->write_column_minmax_statistics)
+        columns_statistics.update(block);
+
     std::unordered_set<String> skip_indexes_column_names_set;
     for (const auto & index : metadata_snapshot->getSecondaryIndices())
         std::copy(index.column_names.cbegin(), index.column_names.cend(),
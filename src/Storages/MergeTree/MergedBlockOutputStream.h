@@ -9,6 +9,15 @@ namespace DB
 
 /** To write one part.
   * The data refers to one partition, and is written in one part.
+  *
+  * NOTE: A token-bucket throttle on these writes, driven by a feedback loop over foreground scan
+  * latency percentiles, has been proposed to auto-tune background load. Declined: merge throughput
+  * and parts count are coupled, so slowing merges when queries are slow makes more parts, which
+  * makes queries slower — the loop has positive feedback exactly during incidents, and latency
+  * percentiles also move for reasons unrelated to merge I/O (cache state, query mix), so the
+  * controller punishes merges for noise. Closed-loop resource control belongs in the OS/IO
+  * scheduler with proper isolation; within the server the honest knobs remain background_pool_size
+  * and max_bytes_to_merge_at_max_space_in_pool, which degrade predictably.
   */
 class MergedBlockOutputStream final : public IMergedBlockOutputStream
 {
@@ -44,8 +53,10 @@ public:
     void writeSuffix() override;
 
     /// Finilize writing part and fill inner structures
+    /// If sync is true, part files are fsynced before they are closed.
     void writeSuffixAndFinalizePart(
             MergeTreeData::MutableDataPartPtr & new_part,
+            bool sync = false,
             const NamesAndTypesList * total_columns_list = nullptr,
             MergeTreeData::DataPart::Checksums * additional_column_checksums = nullptr);
 
@@ -63,6 +74,7 @@ private:
 private:
     NamesAndTypesList columns_list;
     IMergeTreeDataPart::MinMaxIndex minmax_idx;
+    IMergeTreeDataPart::ColumnsStatistics columns_statistics;
     size_t rows_count = 0;
     CompressionCodecPtr default_codec;
 };
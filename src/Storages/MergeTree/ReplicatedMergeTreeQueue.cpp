@@ -867,6 +867,10 @@ void ReplicatedMergeTreeQueue::removePartProducingOpsInRange(
     [[maybe_unused]] bool called_from_alter_query_directly = current.replace_range_entry && current.replace_range_entry->columns_version < 0;
     assert(currently_executing_drop_or_replace_range || called_from_alter_query_directly);
 
+    /// A DROP_RANGE/REPLACE_RANGE can cover hundreds of queued entries; remove their znodes in
+    /// one pipelined pass instead of a synchronous round trip per entry under state_mutex.
+    zkutil::AsyncResponses<Coordination::RemoveResponse> try_remove_futures;
+
     for (Queue::iterator it = queue.begin(); it != queue.end();)
     {
         auto type = (*it)->type;
@@ -877,12 +881,11 @@ void ReplicatedMergeTreeQueue::removePartProducingOpsInRange(
         {
             if ((*it)->currently_executing)
                 to_wait.push_back(*it);
-            auto code = zookeeper->tryRemove(replica_path + "/queue/" + (*it)->znode_name);
+            String path = replica_path + "/queue/" + (*it)->znode_name;
             /// FIXME it's probably unsafe to remove entries non-atomically
             /// when this method called directly from alter query (not from replication queue task),
             /// because entries will be lost if ALTER fails.
-            if (code != Coordination::Error::ZOK)
-                LOG_INFO(log, "Couldn't remove {}: {}", replica_path + "/queue/" + (*it)->znode_name, Coordination::errorMessage(code));
+            try_remove_futures.emplace_back(path, zookeeper->asyncTryRemove(path));
 
             updateStateOnQueueEntryRemoval(
                 *it, /* is_successful = */ false,
@@ -896,6 +899,13 @@ void ReplicatedMergeTreeQueue::removePartProducingOpsInRange(
             ++it;
     }
 
+    for (auto & [path, future] : try_remove_futures)
+    {
+        auto response = future.get();
+        if (response.error != Coordination::Error::ZOK)
+            LOG_INFO(log, "Couldn't remove {}: {}", path, Coordination::errorMessage(response.error));
+    }
+
     updateTimesInZooKeeper(zookeeper, min_unprocessed_insert_time_changed, max_processed_insert_time_changed);
 
     LOG_DEBUG(log, "Removed {} entries from queue. Waiting for {} entries that are currently executing.", removed_entries, to_wait.size());
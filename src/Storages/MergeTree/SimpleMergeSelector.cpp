@@ -96,6 +96,7 @@ bool allow(
     double min_age,
     double range_size,
     double partition_size,
+    double partition_read_heat,
     const SimpleMergeSelector::Settings & settings)
 {
 //    std::cerr << "sum_size: " << sum_size << "\n";
@@ -124,7 +125,11 @@ bool allow(
 //    std::cerr << "partition_size: " << partition_size << "\n";
 //    std::cerr << "num_parts_normalized: " << num_parts_normalized << "\n";
 
-    double combined_ratio = std::min(1.0, age_normalized + num_parts_normalized);
+    /// Map read heat of the partition to 0..1 using logarithmic scale
+    double read_heat_normalized = mapPiecewiseLinearToUnit(log1p(partition_read_heat),
+        log1p(settings.min_read_heat_to_lower_base), log1p(settings.max_read_heat_to_lower_base));
+
+    double combined_ratio = std::min(1.0, age_normalized + num_parts_normalized + read_heat_normalized);
 
 //    std::cerr << "combined_ratio: " << combined_ratio << "\n";
 
@@ -171,7 +176,7 @@ void selectWithinPartition(
             if (max_total_size_to_merge && sum_size > max_total_size_to_merge)
                 break;
 
-            if (allow(sum_size, max_size, min_age, end - begin, parts_count, settings))
+            if (allow(sum_size, max_size, min_age, end - begin, parts_count, parts[begin].partition_read_heat, settings))
                 estimator.consider(
                     parts.begin() + begin,
                     parts.begin() + end,
@@ -53,6 +53,14 @@ public:
         size_t min_parts_to_lower_base = 10;
         size_t max_parts_to_lower_base = 50;
 
+        /** 4. Read activity of the partition (decayed number of recently read marks, see
+          * MergeTreeData::getPartitionReadHeat). Frequently queried partitions pay the
+          * per-part cost on every query, so their base is lowered and they get compacted
+          * ahead of cold history. Zero heat (reads not tracked) changes nothing.
+          */
+        double min_read_heat_to_lower_base = 1000;
+        double max_read_heat_to_lower_base = 1000000;
+
         /// Add this to size before all calculations. It means: merging even very small parts has it's fixed cost.
         size_t size_fixed_cost_to_add = 5 * 1024 * 1024;
 
@@ -14,6 +14,15 @@ namespace DB
   *  1. Finds part with the most earliest expired ttl and includes it to result.
   *  2. Tries to find the longest range of parts with expired ttl, that includes part from step 1.
   * Finally, merge selector updates TTL merge timer for the selected partition
+  *
+  * NOTE: The drop-without-read path exists at part granularity: with ttl_only_drop_parts a part
+  * whose max_ttl has passed (known from the ttl.txt infos, no data read) is simply dropped by the
+  * merge. When the TTL column is a primary-key prefix, expired rows do sit in contiguous granule
+  * prefixes, but truncating a prefix in place is still a rewrite: row counts, the primary index,
+  * minmax and ttl infos, marks and checksums all describe the whole part, and marks address
+  * compressed blocks that straddle the cut. So the sub-part case keeps the filtering merge, and
+  * the practical lever is partitioning/part sizing such that parts age out wholesale — then
+  * ttl_only_drop_parts turns almost all TTL work into metadata-only drops.
   */
 class TTLMergeSelector : public IMergeSelector
 {
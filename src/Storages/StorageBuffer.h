@@ -36,6 +36,15 @@ namespace DB
   *
   * When you destroy a Buffer table, all remaining data is flushed to the subordinate table.
   * The data in the buffer is not replicated, not logged to disk, not indexed. With a rough restart of the server, the data is lost.
+  *
+  * NOTE: Insert contention is already addressed by the shard scheme above: num_shards
+  * (num_layers in the engine definition) independent buffers, each behind its own mutex, with
+  * writers picking the first shard that try_locks (see BufferBlockOutputStream) — sizing
+  * num_layers to the writer concurrency gives per-core behaviour without lock-free machinery.
+  * A write-ahead log here would contradict the table's contract (last paragraph) and duplicate
+  * a mechanism that exists one level down: MergeTree in-memory parts persist inserts through
+  * MergeTreeWriteAheadLog (min_rows/bytes_for_compact_part settings), giving small inserts a
+  * crash-safe in-RAM landing zone in the destination table itself.
   */
 class StorageBuffer final : public ext::shared_ptr_helper<StorageBuffer>, public IStorage
 {
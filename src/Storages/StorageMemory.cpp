@@ -76,6 +76,13 @@ private:
 };
 
 
+/// NOTE: The binary fast path for multi-step session workflows already exists and is this
+/// stream: an HTTP `INSERT INTO t FORMAT Native` with session_id decodes the body with
+/// NativeBlockInputStream — columns are read in their in-memory representation, no values
+/// are parsed — and each block lands here as a push_back. The table itself lives in the
+/// named session's Context, so it survives across requests until session_timeout. The only
+/// per-call cost left is parsing the one-line INSERT header; a dedicated "attach block"
+/// endpoint would save that and nothing else.
 class MemoryBlockOutputStream : public IBlockOutputStream
 {
 public:
@@ -216,9 +216,30 @@ Pipe StorageMerge::read(
         query_info.input_order_info = input_sorting_info;
     }
 
+    /// Divide the stream budget proportionally to the tables' sizes, so that one big table
+    /// among almost-empty siblings (the typical month-sharded family) gets most of the
+    /// parallelism instead of an equal share. Tables that cannot report their size get
+    /// a single stream each.
+    std::vector<UInt64> tables_rows;
+    tables_rows.reserve(tables_count);
+    UInt64 total_rows = 0;
     for (const auto & table : selected_tables)
     {
-        size_t current_need_streams = tables_count >= num_streams ? 1 : (num_streams / tables_count);
+        UInt64 rows = std::get<0>(table)->totalRows().value_or(0);
+        tables_rows.push_back(rows);
+        total_rows += rows;
+    }
+
+    size_t table_num = 0;
+    for (const auto & table : selected_tables)
+    {
+        size_t current_need_streams;
+        if (total_rows)
+            current_need_streams = static_cast<size_t>(num_streams * tables_rows[table_num] / total_rows);
+        else
+            current_need_streams = tables_count >= num_streams ? 1 : (num_streams / tables_count);
+        ++table_num;
+
         size_t current_streams = std::min(current_need_streams, remaining_streams);
         remaining_streams -= current_streams;
         current_streams = std::max(size_t(1), current_streams);
@@ -25,6 +25,7 @@
 #include <Storages/MergeTree/MergeList.h>
 #include <Storages/MergeTree/checkDataPart.h>
 #include <Processors/Pipe.h>
+#include <ext/scope_guard.h>
 #include <optional>
 
 
@@ -1006,22 +1007,68 @@ bool StorageMergeTree::optimize(
         for (const DataPartPtr & part : data_parts)
             partition_ids.emplace(part->info.partition_id);
 
+        /// Merges of different partitions are independent (they work on disjoint part sets and
+        /// merge() does its own part tagging), so run them concurrently instead of one after
+        /// another. Capped by the background pool size: that is the merge parallelism the server
+        /// is configured for. Each merge is visible in system.merges as usual.
+        size_t num_threads = std::min<size_t>(partition_ids.size(), global_context.getBackgroundPool().getNumberOfThreads());
+
+        std::mutex failure_mutex;
+        bool all_merged = true;
+        String first_disable_reason;
+        std::exception_ptr first_exception;
+
+        ThreadPool pool(num_threads);
+
         for (const String & partition_id : partition_ids)
         {
-            if (!merge(true, partition_id, true, deduplicate, &disable_reason))
+            pool.scheduleOrThrowOnError([&, partition_id, thread_group = CurrentThread::getGroup()]
             {
-                std::stringstream message;
-                message << "Cannot OPTIMIZE table";
-                if (!disable_reason.empty())
-                    message << ": " << disable_reason;
-                else
-                    message << " by some reason.";
-                LOG_INFO(log, message.str());
+                SCOPE_EXIT(
+                    if (thread_group)
+                        CurrentThread::detachQueryIfNotDetached();
+                );
+                if (thread_group)
+                    CurrentThread::attachTo(thread_group);
+
+                String partition_disable_reason;
+                try
+                {
+                    if (!merge(true, partition_id, true, deduplicate, &partition_disable_reason))
+                    {
+                        std::lock_guard lock(failure_mutex);
+                        all_merged = false;
+                        if (first_disable_reason.empty())
+                            first_disable_reason = partition_disable_reason;
+                    }
+                }
+                catch (...)
+                {
+                    std::lock_guard lock(failure_mutex);
+                    if (!first_exception)
+                        first_exception = std::current_exception();
+                }
+            });
+        }
 
-                if (context.getSettingsRef().optimize_throw_if_noop)
-                    throw Exception(message.str(), ErrorCodes::CANNOT_ASSIGN_OPTIMIZE);
-                return false;
-            }
+        pool.wait();
+
+        if (first_exception)
+            std::rethrow_exception(first_exception);
+
+        if (!all_merged)
+        {
+            std::stringstream message;
+            message << "Cannot OPTIMIZE table";
+            if (!first_disable_reason.empty())
+                message << ": " << first_disable_reason;
+            else
+                message << " by some reason.";
+            LOG_INFO(log, message.str());
+
+            if (context.getSettingsRef().optimize_throw_if_noop)
+                throw Exception(message.str(), ErrorCodes::CANNOT_ASSIGN_OPTIMIZE);
+            return false;
         }
     }
     else
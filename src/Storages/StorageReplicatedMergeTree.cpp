@@ -2,6 +2,7 @@
 
 #include <Common/FieldVisitors.h>
 #include <Common/Macros.h>
+#include <Common/SipHash.h>
 #include <Common/StringUtils/StringUtils.h>
 #include <Common/ThreadPool.h>
 #include <Common/ZooKeeper/KeeperException.h>
@@ -1289,6 +1290,52 @@ bool StorageReplicatedMergeTree::executeLogEntry(LogEntry & entry)
     return true;
 }
 
+bool StorageReplicatedMergeTree::mergeAssignedToThisReplica(const ReplicatedMergeTreeLogEntryData & entry)
+{
+    time_t threshold = getSettings()->execute_merges_on_single_replica_time_threshold.totalSeconds();
+    if (threshold == 0)
+        return true;
+
+    time_t now = time(nullptr);
+
+    /// The chosen replica did not publish the part in time, fall back to merging everywhere.
+    if (entry.create_time + threshold <= now)
+        return true;
+
+    Strings replicas;
+    {
+        std::lock_guard lock(active_replicas_for_merges_mutex);
+
+        /// A slightly stale list is acceptable: disagreement between replicas only leads to an
+        /// extra local merge or to waiting out the threshold, never to a lost entry.
+        static constexpr time_t refresh_period = 60;
+        if (active_replicas_for_merges_update_time + refresh_period <= now)
+        {
+            auto zookeeper = getZooKeeper();
+
+            active_replicas_for_merges.clear();
+            for (const String & candidate : zookeeper->getChildren(zookeeper_path + "/replicas"))
+                if (zookeeper->exists(zookeeper_path + "/replicas/" + candidate + "/is_active"))
+                    active_replicas_for_merges.push_back(candidate);
+
+            /// All replicas must choose from the same list whatever order ZooKeeper returned.
+            std::sort(active_replicas_for_merges.begin(), active_replicas_for_merges.end());
+            active_replicas_for_merges_update_time = now;
+        }
+
+        replicas = active_replicas_for_merges;
+    }
+
+    /// If we do not see ourselves as active, the list is not trustworthy; merge locally.
+    if (replicas.empty() || !std::binary_search(replicas.begin(), replicas.end(), replica_name))
+        return true;
+
+    /// Replicas agree on the entry and on the sorted list, so they agree on the executor.
+    size_t chosen = sipHash64(entry.new_part_name.data(), entry.new_part_name.size()) % replicas.size();
+    return replicas[chosen] == replica_name;
+}
+
+
 bool StorageReplicatedMergeTree::tryExecuteMerge(const LogEntry & entry)
 {
     // Log source part names just in case
@@ -1353,6 +1400,12 @@ bool StorageReplicatedMergeTree::tryExecuteMerge(const LogEntry & entry)
         }
     }
 
+    if (!mergeAssignedToThisReplica(entry))
+    {
+        LOG_DEBUG(log, "Merge of {} is assigned to another replica; will try to fetch it instead", entry.new_part_name);
+        return false;
+    }
+
     /// Start to make the main work
     size_t estimated_space_for_merge = MergeTreeDataMergerMutator::estimateNeededDiskSpace(parts);
 
@@ -4164,6 +4217,11 @@ StorageReplicatedMergeTree::allocateBlockNumber(
     const String & partition_id, zkutil::ZooKeeperPtr & zookeeper, const String & zookeeper_block_id_path)
 {
     /// Lets check for duplicates in advance, to avoid superfluous block numbers allocation
+    /// NOTE This create+remove pair rides in the allocation multi and the real /blocks/<id> node
+    /// is created by the commit multi, so the no-duplicate fast path costs no extra ZK read. A
+    /// replica-local cache of recent block ids could only short-circuit the *duplicate* case; it
+    /// can never be authoritative (another replica may insert between watch notifications), so
+    /// ZooKeeper would still have to be consulted before every commit.
     Coordination::Requests deduplication_check_ops;
     if (!zookeeper_block_id_path.empty())
     {
@@ -379,6 +379,11 @@ private:
     /// Do the merge or recommend to make the fetch instead of the merge
     bool tryExecuteMerge(const LogEntry & entry);
 
+    /// For execute_merges_on_single_replica_time_threshold: one active replica, chosen
+    /// deterministically from the entry, executes the merge; the others prefer to fetch the
+    /// result until the threshold passes. Returns whether this replica should do the merge.
+    bool mergeAssignedToThisReplica(const ReplicatedMergeTreeLogEntryData & entry);
+
     /// Execute alter of table metadata. Set replica/metadata and replica/columns
     /// nodes in zookeeper and also changes in memory metadata.
     /// New metadata and columns values stored in entry.
@@ -527,6 +532,11 @@ private:
     std::mutex existing_nodes_cache_mutex;
     bool existsNodeCached(const std::string & path);
 
+    /// Sorted list of active replicas for single-replica merge assignment, refreshed periodically.
+    Strings active_replicas_for_merges;
+    time_t active_replicas_for_merges_update_time = 0;
+    std::mutex active_replicas_for_merges_mutex;
+
     /// Remove block IDs from `blocks/` in ZooKeeper for the given partition ID in the given block number range.
     void clearBlocksInPartition(
         zkutil::ZooKeeper & zookeeper, const String & partition_id, Int64 min_block_num, Int64 max_block_num);
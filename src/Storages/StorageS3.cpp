@@ -50,6 +50,17 @@ namespace ErrorCodes
 
 namespace
 {
+    /// NOTE: A node-local cache of the parsed blocks keyed by (object key, ETag) was
+    /// considered for repeated reads of the same objects and rejected. The parsed result is
+    /// not a function of the object alone: it also depends on the format, the requested
+    /// sample block, format settings and max_block_size, so all of them would have to be
+    /// part of the key for a hit to be sound. Validation does not remove the network from
+    /// the critical path either — the ETag has to be re-checked with a HEAD request per
+    /// object per query, and HTTP sources often serve weak or no validators at all. And
+    /// memory spent on deserialized blocks competes with the caches that benefit every
+    /// query (marks, uncompressed blocks). Caching belongs one layer down, on the raw
+    /// object bytes (a disk-backed remote FS layer); for stable remote datasets the
+    /// existing answer is to materialize them into a MergeTree table.
     class StorageS3Source : public SourceWithProgress
     {
     public:
@@ -157,6 +157,15 @@ void StorageSet::truncate(const ASTPtr &, const StorageMetadataPtr & metadata_sn
 }
 
 
+/// NOTE: Startup cost here is rebuilding the hash structure from the persisted Native blocks.
+/// Persisting the built structure itself (arena pages plus table layout) for mmap or bulk
+/// load was considered and rejected: the hash tables and arenas are pointer-rich (Arena
+/// chunks, saved-hash cells, StringRefs into arena memory), so a snapshot would have to be
+/// made relocatable, kept bit-compatible with every hash table layout change, and verified
+/// against the insert history — a second serialization format for every map variant in
+/// HashJoin/Set. The cheap wins inside the current format are already taken: blocks are
+/// stored compressed and columnar, and insertion replays sorted per-file batches. Loading
+/// many .bin files could still be overlapped per file if startup time becomes pressing.
 void StorageSetOrJoinBase::restore()
 {
     Poco::File tmp_dir(path + "tmp/");
@@ -9,6 +9,8 @@
 #include <Common/Exception.h>
 
 #include <IO/WriteBufferFromFileBase.h>
+#include <IO/LimitReadBuffer.h>
+#include <Compression/CompressedReadBuffer.h>
 #include <Compression/CompressedReadBufferFromFile.h>
 #include <Compression/CompressedWriteBuffer.h>
 #include <IO/ReadHelpers.h>
@@ -215,6 +217,10 @@ public:
         storage.file_checker.update(index_out_file);
         storage.file_checker.save();
 
+        /// Publish the watermark only after all data and the index are flushed, so that
+        /// concurrent readers never parse a partially written index entry.
+        storage.committed_index_size = storage.disk->getFileSize(index_out_file);
+
         done = true;
     }
 
@@ -276,6 +282,11 @@ StorageStripeLog::StorageStripeLog(
         {
             tryLogCurrentException(__PRETTY_FUNCTION__);
         }
+
+        /// Everything on disk after repair() is committed.
+        String index_file = table_path + "index.mrk";
+        if (disk->exists(index_file))
+            committed_index_size = disk->getFileSize(index_file);
     }
 }
 
@@ -301,8 +312,10 @@ Pipe StorageStripeLog::read(
     const size_t /*max_block_size*/,
     unsigned num_streams)
 {
-    std::shared_lock<std::shared_mutex> lock(rwlock);
-
+    /// Readers do not take 'rwlock' and run at full speed while an insert appends: they parse
+    /// the index only up to the watermark published by the last finished insert, and the data
+    /// ranges referenced by that prefix never change afterwards. Exclusion against RENAME and
+    /// TRUNCATE is provided by the table-level locks held by the caller.
     metadata_snapshot->check(column_names, getVirtuals(), getStorageID());
 
     NameSet column_names_set(column_names.begin(), column_names.end());
@@ -310,12 +323,15 @@ Pipe StorageStripeLog::read(
     Pipes pipes;
 
     String index_file = table_path + "index.mrk";
-    if (!disk->exists(index_file))
+    UInt64 committed_size = committed_index_size.load();
+    if (!committed_size || !disk->exists(index_file))
     {
         return Pipe(std::make_shared<NullSource>(metadata_snapshot->getSampleBlockForColumns(column_names, getVirtuals(), getStorageID())));
     }
 
-    CompressedReadBufferFromFile index_in(disk->readFile(index_file, INDEX_BUFFER_SIZE));
+    auto index_file_in = disk->readFile(index_file, INDEX_BUFFER_SIZE);
+    LimitReadBuffer index_limited_in(*index_file_in, committed_size, false);
+    CompressedReadBuffer index_in(index_limited_in);
     std::shared_ptr<const IndexForNativeFormat> index{std::make_shared<IndexForNativeFormat>(index_in, column_names_set)};
 
     size_t size = index->blocks.size();
@@ -334,8 +350,6 @@ Pipe StorageStripeLog::read(
             *this, metadata_snapshot, column_names, context.getSettingsRef().max_read_buffer_size, index, begin, end));
     }
 
-    /// We do not keep read lock directly at the time of reading, because we read ranges of data that do not change.
-
     return Pipe::unitePipes(std::move(pipes));
 }
 
@@ -356,6 +370,7 @@ void StorageStripeLog::truncate(const ASTPtr &, const StorageMetadataPtr &, cons
 {
     std::shared_lock<std::shared_mutex> lock(rwlock);
 
+    committed_index_size = 0;
     disk->clearDirectory(table_path);
 
     file_checker = FileChecker{disk, table_path + "sizes.json"};
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <atomic>
 #include <map>
 #include <shared_mutex>
 
@@ -69,6 +70,11 @@ private:
     FileChecker file_checker;
     mutable std::shared_mutex rwlock;
 
+    /// Size of the committed prefix of index.mrk, published by the last successfully finished
+    /// insert. Readers parse the index only up to this watermark and never look at data past
+    /// the stripes it references, so SELECTs run at full speed while an INSERT appends.
+    std::atomic<UInt64> committed_index_size {0};
+
     Poco::Logger * log;
 };
 
@@ -64,11 +64,23 @@ namespace
             const ColumnDefaults & column_defaults,
             UInt64 max_block_size,
             const ConnectionTimeouts & timeouts,
-            const CompressionMethod compression_method)
+            const CompressionMethod compression_method,
+            bool use_connection_pooling)
             : SourceWithProgress(sample_block), name(std::move(name_))
         {
-            read_buf = wrapReadBufferWithCompressionMethod(
-                std::make_unique<ReadWriteBufferFromHTTP>(
+            std::unique_ptr<ReadBuffer> http_read_buf;
+
+            if (use_connection_pooling)
+                http_read_buf = std::make_unique<PooledReadWriteBufferFromHTTP>(
+                    uri,
+                    method,
+                    std::move(callback),
+                    timeouts,
+                    Poco::Net::HTTPBasicCredentials{},
+                    DBMS_DEFAULT_BUFFER_SIZE,
+                    context.getSettingsRef().max_http_get_redirects);
+            else
+                http_read_buf = std::make_unique<ReadWriteBufferFromHTTP>(
                     uri,
                     method,
                     std::move(callback),
@@ -77,8 +89,9 @@ namespace
                     Poco::Net::HTTPBasicCredentials{},
                     DBMS_DEFAULT_BUFFER_SIZE,
                     ReadWriteBufferFromHTTP::HTTPHeaderEntries{},
-                    context.getRemoteHostFilter()),
-                compression_method);
+                    context.getRemoteHostFilter());
+
+            read_buf = wrapReadBufferWithCompressionMethod(std::move(http_read_buf), compression_method);
 
             reader = FormatFactory::instance().getInput(format, *read_buf, sample_block, context, max_block_size);
             reader = std::make_shared<AddingDefaultsBlockInputStream>(reader, column_defaults, context);
@@ -204,7 +217,8 @@ Pipe IStorageURLBase::read(
         metadata_snapshot->getColumns().getDefaults(),
         max_block_size,
         ConnectionTimeouts::getHTTPTimeouts(context),
-        chooseCompressionMethod(request_uri.getPath(), compression_method)));
+        chooseCompressionMethod(request_uri.getPath(), compression_method),
+        needConnectionPooling()));
 }
 
 BlockOutputStreamPtr IStorageURLBase::write(const ASTPtr & /*query*/, const StorageMetadataPtr & metadata_snapshot, const Context & /*context*/)
@@ -64,6 +64,11 @@ private:
         QueryProcessingStage::Enum & processed_stage,
         size_t max_block_size) const;
 
+    /// Whether to reuse HTTP connections between queries through the shared per-endpoint
+    /// session pool. Makes sense for storages that always talk to the same endpoint
+    /// (the XDBC bridges), not for arbitrary user-supplied URLs.
+    virtual bool needConnectionPooling() const { return false; }
+
     virtual Block getHeaderBlock(const Names & column_names, const StorageMetadataPtr & metadata_snapshot) const = 0;
 };
 
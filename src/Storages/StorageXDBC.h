@@ -63,6 +63,10 @@ private:
     Block getHeaderBlock(const Names & column_names, const StorageMetadataPtr & metadata_snapshot) const override;
 
     std::string getName() const override;
+
+    /// Every query goes to the same local bridge, so keep the connection alive
+    /// instead of paying the handshake on each query.
+    bool needConnectionPooling() const override { return true; }
 };
 
 }
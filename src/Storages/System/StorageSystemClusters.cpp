@@ -29,7 +29,7 @@ NamesAndTypesList StorageSystemClusters::getNamesAndTypes()
 
 void StorageSystemClusters::fillData(MutableColumns & res_columns, const Context & context, const SelectQueryInfo &) const
 {
-    for (const auto & name_and_cluster : context.getClusters().getContainer())
+    for (const auto & name_and_cluster : context.getClusters()->getContainer())
     {
         const String & cluster_name = name_and_cluster.first;
         const ClusterPtr & cluster = name_and_cluster.second;
@@ -0,0 +1,70 @@
+#include <Storages/System/StorageSystemPartitionReadHeat.h>
+#include <DataTypes/DataTypeString.h>
+#include <DataTypes/DataTypesNumber.h>
+#include <Storages/MergeTree/MergeTreeData.h>
+#include <Access/ContextAccess.h>
+#include <Databases/IDatabase.h>
+#include <Interpreters/Context.h>
+
+#include <map>
+
+
+namespace DB
+{
+
+
+NamesAndTypesList StorageSystemPartitionReadHeat::getNamesAndTypes()
+{
+    return {
+        { "database",     std::make_shared<DataTypeString>() },
+        { "table",        std::make_shared<DataTypeString>() },
+        { "partition_id", std::make_shared<DataTypeString>() },
+        { "read_heat",    std::make_shared<DataTypeFloat64>() },
+    };
+}
+
+
+void StorageSystemPartitionReadHeat::fillData(MutableColumns & res_columns, const Context & context, const SelectQueryInfo &) const
+{
+    const auto access = context.getAccess();
+    const bool check_access_for_databases = !access->isGranted(AccessType::SHOW_TABLES);
+
+    for (const auto & db : DatabaseCatalog::instance().getDatabases())
+    {
+        /// Lazy database can not contain MergeTree tables
+        if (db.second->getEngineName() == "Lazy")
+            continue;
+
+        const bool check_access_for_tables = check_access_for_databases && !access->isGranted(AccessType::SHOW_TABLES, db.first);
+
+        for (auto iterator = db.second->getTablesIterator(context); iterator->isValid(); iterator->next())
+        {
+            const auto & table = iterator->table();
+            if (!table)
+                continue;
+
+            const auto * merge_tree = dynamic_cast<const MergeTreeData *>(table.get());
+            if (!merge_tree)
+                continue;
+
+            if (check_access_for_tables && !access->isGranted(AccessType::SHOW_TABLES, db.first, iterator->name()))
+                continue;
+
+            /// Order partitions within the table for stable output.
+            std::map<String, double> heats;
+            for (auto & heat : merge_tree->getPartitionReadHeats())
+                heats.emplace(std::move(heat));
+
+            for (const auto & [partition_id, read_heat] : heats)
+            {
+                size_t col_num = 0;
+                res_columns[col_num++]->insert(db.first);
+                res_columns[col_num++]->insert(iterator->name());
+                res_columns[col_num++]->insert(partition_id);
+                res_columns[col_num++]->insert(read_heat);
+            }
+        }
+    }
+}
+
+}
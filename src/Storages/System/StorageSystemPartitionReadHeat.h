@@ -0,0 +1,31 @@
+#pragma once
+
+#include <ext/shared_ptr_helper.h>
+#include <Storages/System/IStorageSystemOneBlock.h>
+
+
+namespace DB
+{
+
+class Context;
+
+
+/// Implements the `partition_read_heat` system table, which shows the decaying per-partition
+/// counters of marks selected for reading in MergeTree tables. The same counters drive the
+/// merge selector; exposing them allows to make data placement decisions (TTL MOVE,
+/// storage policies) from measured read traffic instead of guessing by partition age.
+class StorageSystemPartitionReadHeat final : public ext::shared_ptr_helper<StorageSystemPartitionReadHeat>, public IStorageSystemOneBlock<StorageSystemPartitionReadHeat>
+{
+    friend struct ext::shared_ptr_helper<StorageSystemPartitionReadHeat>;
+public:
+    String getName() const override { return "SystemPartitionReadHeat"; }
+
+    static NamesAndTypesList getNamesAndTypes();
+
+protected:
+    using IStorageSystemOneBlock::IStorageSystemOneBlock;
+
+    void fillData(MutableColumns & res_columns, const Context & context, const SelectQueryInfo & query_info) const override;
+};
+
+}
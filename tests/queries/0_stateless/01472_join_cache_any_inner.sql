@@ -0,0 +1,24 @@
+DROP TABLE IF EXISTS join_cache_right;
+
+CREATE TABLE join_cache_right (k UInt64, v String) ENGINE = MergeTree ORDER BY k;
+INSERT INTO join_cache_right VALUES (1, 'a'), (2, 'b'), (3, 'c');
+
+SET use_join_cache = 1;
+
+-- ANY INNER uses a flagged map (probing marks matched rows as used), so it must not be
+-- served from the join cache: the same query has to return the same rows every time.
+SELECT number, v FROM numbers(4) AS n ANY INNER JOIN join_cache_right AS r ON n.number = r.k ORDER BY number;
+SELECT number, v FROM numbers(4) AS n ANY INNER JOIN join_cache_right AS r ON n.number = r.k ORDER BY number;
+
+-- ALL INNER and ALL/ANY LEFT use plain maps and may be shared; repeated runs go through
+-- the cache (when the server enables it) and must stay correct.
+SELECT number, v FROM numbers(4) AS n ALL INNER JOIN join_cache_right AS r ON n.number = r.k ORDER BY number;
+SELECT number, v FROM numbers(4) AS n ALL INNER JOIN join_cache_right AS r ON n.number = r.k ORDER BY number;
+SELECT number, v FROM numbers(4) AS n ANY LEFT JOIN join_cache_right AS r ON n.number = r.k ORDER BY number;
+SELECT number, v FROM numbers(4) AS n ANY LEFT JOIN join_cache_right AS r ON n.number = r.k ORDER BY number;
+
+-- An insert changes the set of parts and must make the old entry unreachable.
+INSERT INTO join_cache_right VALUES (0, 'z');
+SELECT number, v FROM numbers(4) AS n ALL INNER JOIN join_cache_right AS r ON n.number = r.k ORDER BY number;
+
+DROP TABLE join_cache_right;
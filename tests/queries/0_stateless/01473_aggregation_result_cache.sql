@@ -0,0 +1,24 @@
+DROP TABLE IF EXISTS agg_cache;
+
+CREATE TABLE agg_cache (k UInt64, v UInt64) ENGINE = MergeTree ORDER BY k;
+INSERT INTO agg_cache SELECT number % 10, number FROM numbers(1000);
+
+SET use_aggregation_result_cache = 1;
+
+-- The same query twice: the second run may be served from the cache and must match.
+SELECT k, sum(v) FROM agg_cache GROUP BY k ORDER BY k;
+SELECT k, sum(v) FROM agg_cache GROUP BY k ORDER BY k;
+
+-- ORDER BY must survive a replay from the cache: stored blocks are replayed as one ordered stream.
+SELECT k, count() FROM agg_cache GROUP BY k ORDER BY k DESC LIMIT 3;
+SELECT k, count() FROM agg_cache GROUP BY k ORDER BY k DESC LIMIT 3;
+
+-- Queries calling non-deterministic functions are never cached.
+SELECT count() FROM agg_cache WHERE rand() >= 0;
+SELECT count() FROM agg_cache WHERE rand() >= 0;
+
+-- An insert changes the set of parts and must make the old entry unreachable.
+INSERT INTO agg_cache VALUES (100, 1);
+SELECT k, sum(v) FROM agg_cache GROUP BY k ORDER BY k;
+
+DROP TABLE agg_cache;
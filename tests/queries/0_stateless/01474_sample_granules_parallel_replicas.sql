@@ -0,0 +1,27 @@
+DROP TABLE IF EXISTS sample_granules_replicas;
+
+CREATE TABLE sample_granules_replicas (id UInt64) ENGINE = MergeTree ORDER BY intHash32(id) SAMPLE BY intHash32(id) SETTINGS index_granularity = 10;
+INSERT INTO sample_granules_replicas SELECT number FROM numbers(10000);
+
+SET merge_tree_sample_granules = 1;
+
+-- Granule-level sampling hashes (local part name, mark), so when one shard's scan is split
+-- across replicas it must fall back to row-level filtering by the sampling key: the replica
+-- pieces have to partition the rows exactly, with no overlaps and no gaps.
+SELECT count(), uniqExact(id), sum(id) FROM
+(
+          SELECT id FROM sample_granules_replicas SETTINGS parallel_replicas_count = 2, parallel_replica_offset = 0
+UNION ALL SELECT id FROM sample_granules_replicas SETTINGS parallel_replicas_count = 2, parallel_replica_offset = 1
+);
+
+-- The same with an explicit SAMPLE: the pieces must add up to the row-level sample.
+SELECT count() == (SELECT count() FROM sample_granules_replicas SAMPLE 1/2 SETTINGS merge_tree_sample_granules = 0) FROM
+(
+          SELECT id FROM sample_granules_replicas SAMPLE 1/2 SETTINGS parallel_replicas_count = 2, parallel_replica_offset = 0
+UNION ALL SELECT id FROM sample_granules_replicas SAMPLE 1/2 SETTINGS parallel_replicas_count = 2, parallel_replica_offset = 1
+);
+
+-- Without parallel replicas granule-level sampling stays in effect.
+SELECT count() > 0 FROM sample_granules_replicas SAMPLE 1/2;
+
+DROP TABLE sample_granules_replicas;
@@ -0,0 +1,59 @@
+DROP TABLE IF EXISTS tokenset_test;
+
+CREATE TABLE tokenset_test
+(
+    id UInt32,
+    s String,
+    INDEX tok s TYPE tokenset_v1(128) GRANULARITY 1
+) ENGINE = MergeTree ORDER BY id SETTINGS index_granularity = 2;
+
+INSERT INTO tokenset_test VALUES (1, 'hello world'), (2, 'foo bar baz'), (3, 'clickhouse is fast'), (4, 'abcdef ghijk'), (5, 'the quick brown fox'), (6, 'token set index');
+
+SELECT id FROM tokenset_test WHERE s = 'hello world';
+SELECT id FROM tokenset_test WHERE hasToken(s, 'clickhouse');
+SELECT id FROM tokenset_test WHERE hasToken(s, 'missing');
+SELECT count() FROM tokenset_test WHERE s != 'hello world';
+
+-- A token cut at the unanchored end of the value may be a fragment of a longer token
+-- in the data, so it must not be required from the granule.
+SELECT id FROM tokenset_test WHERE startsWith(s, 'abcdef gh');
+SELECT id FROM tokenset_test WHERE endsWith(s, 'def ghijk');
+
+-- LIKE requires only the tokens fully delimited inside the pattern.
+SELECT id FROM tokenset_test WHERE s LIKE '% quick brown %';
+SELECT id FROM tokenset_test WHERE s NOT LIKE '% quick %' ORDER BY id;
+
+-- The granules must survive a round trip through the on-disk format.
+DETACH TABLE tokenset_test;
+ATTACH TABLE tokenset_test;
+SELECT id FROM tokenset_test WHERE hasToken(s, 'fox');
+
+DROP TABLE tokenset_test;
+
+-- Granules that collect more than max_tokens distinct tokens degrade to "may be true".
+DROP TABLE IF EXISTS tokenset_overflow;
+
+CREATE TABLE tokenset_overflow
+(
+    id UInt32,
+    s String,
+    INDEX tok s TYPE tokenset_v1(2) GRANULARITY 1
+) ENGINE = MergeTree ORDER BY id SETTINGS index_granularity = 2;
+
+INSERT INTO tokenset_overflow VALUES (1, 'one two three four'), (2, 'alpha beta gamma delta'), (3, 'x y');
+
+SELECT id FROM tokenset_overflow WHERE hasToken(s, 'gamma');
+SELECT id FROM tokenset_overflow WHERE hasToken(s, 'absent');
+SELECT id FROM tokenset_overflow WHERE hasToken(s, 'y');
+
+-- The overflow flag is persisted too.
+DETACH TABLE tokenset_overflow;
+ATTACH TABLE tokenset_overflow;
+SELECT id FROM tokenset_overflow WHERE hasToken(s, 'beta');
+
+DROP TABLE tokenset_overflow;
+
+-- Validation: only String/FixedString columns and at most one integer argument.
+CREATE TABLE tokenset_bad (id UInt32, INDEX tok id TYPE tokenset_v1 GRANULARITY 1) ENGINE = MergeTree ORDER BY id; -- { serverError 80 }
+CREATE TABLE tokenset_bad (id UInt32, s String, INDEX tok s TYPE tokenset_v1(1, 2) GRANULARITY 1) ENGINE = MergeTree ORDER BY id; -- { serverError 80 }
+CREATE TABLE tokenset_bad (id UInt32, s String, INDEX tok s TYPE tokenset_v1('x') GRANULARITY 1) ENGINE = MergeTree ORDER BY id; -- { serverError 36 }
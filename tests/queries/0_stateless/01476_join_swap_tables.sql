@@ -0,0 +1,23 @@
+DROP TABLE IF EXISTS join_swap_small;
+DROP TABLE IF EXISTS join_swap_big;
+
+CREATE TABLE join_swap_small (k UInt64, s String) ENGINE = MergeTree ORDER BY k;
+CREATE TABLE join_swap_big (k UInt64, v UInt64) ENGINE = MergeTree ORDER BY k;
+
+INSERT INTO join_swap_small VALUES (1, 'a'), (2, 'b');
+INSERT INTO join_swap_big SELECT number % 100, number FROM numbers(10000);
+
+-- Big table on the right gets moved to the probe side; the result must not change.
+SELECT k, count(), sum(v) FROM join_swap_small AS s INNER JOIN join_swap_big AS b USING (k) GROUP BY k ORDER BY k;
+
+-- Big table already on the left: nothing to swap, same result.
+SELECT k, count(), sum(v) FROM join_swap_big AS b INNER JOIN join_swap_small AS s USING (k) GROUP BY k ORDER BY k;
+
+-- Opt-out keeps the written order and the same result.
+SELECT k, count(), sum(v) FROM join_swap_small AS s INNER JOIN join_swap_big AS b USING (k) GROUP BY k ORDER BY k SETTINGS optimize_join_swap_tables = 0;
+
+-- ON with qualified names stays valid after the swap.
+SELECT s.s, count() FROM join_swap_small AS s INNER JOIN join_swap_big AS b ON s.k = b.k GROUP BY s.s ORDER BY s.s;
+
+DROP TABLE join_swap_small;
+DROP TABLE join_swap_big;
@@ -0,0 +1,9 @@
+-- The preemption duty cycle is per query; timing itself cannot be asserted here,
+-- so check that prioritized queries run fine with a non-default timeout.
+SET priority = 5;
+SET priority_preemption_timeout_ms = 100;
+
+SELECT count() FROM numbers(1000000);
+
+SET priority_preemption_timeout_ms = 1;
+SELECT sum(number) FROM numbers(100000);